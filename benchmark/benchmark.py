@@ -1,6 +1,5 @@
 # openjij-dense, openjij-sparse, neal
 # でのベンチマーク用のスクリプト
-# sparse は遅すぎるのでベンチマーク測定できない
 
 import openjij as oj
 import neal
@@ -0,0 +1,31 @@
+# graph_coloring=True のスレッド数に対するスケーリングを測るベンチマーク
+# (一つの read の中で同じ色のスピンを並列に更新する)
+
+import os
+import time
+
+import numpy as np
+import openjij as oj
+
+L = 300
+h, J = {}, {}
+rng = np.random.default_rng(0)
+for x in range(L):
+    for y in range(L):
+        i = x * L + y
+        J[i, ((x + 1) % L) * L + y] = rng.uniform(-1, 1)
+        J[i, x * L + (y + 1) % L] = rng.uniform(-1, 1)
+
+NUM_SWEEPS = 200
+
+sampler = oj.SASampler()
+print('N = {0}, num_sweeps = {1}'.format(L * L, NUM_SWEEPS))
+base_time = None
+for num_threads in [1, 2, 4, 8, os.cpu_count()]:
+    start = time.time()
+    response = sampler.sample_ising(h, J, sparse=True, num_reads=1, num_sweeps=NUM_SWEEPS,
+                                    graph_coloring=True, num_threads=num_threads, seed=1)
+    elapsed_time = time.time() - start
+    base_time = base_time or elapsed_time
+    print("\tnum_threads:{0}\telapsed_time:{1:.3f}[sec]\tspeedup:{2:.2f}\tenergy:{3}".format(
+        num_threads, elapsed_time, base_time / elapsed_time, response.first.energy))
@@ -14,7 +14,13 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <functional>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
 
 #include "openjij/system/system.hpp"
 #include "openjij/utility/schedule_list.hpp"
@@ -73,6 +79,9 @@ enum class UpdateMethod {
 
    //! @brief Metropolis update with optimal transition
    OPT_METROPOLIS,
+
+   //! @brief Rejection-free (n-fold way) Metropolis update with random variable selection
+   REJECTION_FREE,
 };
 
 enum class RandomNumberEngine {
@@ -84,26 +93,161 @@ enum class RandomNumberEngine {
    MT,
    
    //! @brief 64-bit Mersenne Twister
-   MT_64
+   MT_64,
+   
+   //! @brief Counter-based Philox4x32-10, whose streams do not depend on the number of threads
+   PHILOX,
+   
+   //! @brief xoshiro256++ generating blocks of random numbers with SIMD instructions
+   XOSHIRO,
+   
+   //! @brief 128-bit permuted congruential generator
+   PCG64
    
 };
 
 
-std::variant<utility::Xorshift, std::mt19937, std::mt19937_64>
-GenerateRandomNumberEngineClass(const RandomNumberEngine random_number_engine) {
-   if (random_number_engine == RandomNumberEngine::XORSHIFT) {
-      return utility::Xorshift();
+//! @brief Tag carrying a random number engine class, which is passed to the function given to DispatchRandomNumberEngine.
+template<class RandType>
+struct RandomNumberEngineTag {
+   using type = RandType;
+};
+
+//! @brief Call the function with the tag of the random number engine class.
+//! This is the only place where RandomNumberEngine is mapped to the engine classes,
+//! so that each templated sampler kernel is dispatched here once for all engines.
+//! @param random_number_engine The random number engine.
+//! @param function Function taking RandomNumberEngineTag, whose return type must not depend on the engine.
+//! @return The return value of the function.
+template<class Function>
+decltype(auto) DispatchRandomNumberEngine(const RandomNumberEngine random_number_engine, Function &&function) {
+   switch (random_number_engine) {
+      case RandomNumberEngine::XORSHIFT:
+         return function(RandomNumberEngineTag<utility::Xorshift>{});
+      case RandomNumberEngine::MT:
+         return function(RandomNumberEngineTag<std::mt19937>{});
+      case RandomNumberEngine::MT_64:
+         return function(RandomNumberEngineTag<std::mt19937_64>{});
+      case RandomNumberEngine::PHILOX:
+         return function(RandomNumberEngineTag<utility::Philox4x32>{});
+      case RandomNumberEngine::XOSHIRO:
+         return function(RandomNumberEngineTag<utility::Xoshiro256pp>{});
+      case RandomNumberEngine::PCG64:
+         return function(RandomNumberEngineTag<utility::PCG64>{});
+      default:
+         throw std::runtime_error("Unknown RandomNumberEngine");
    }
-   else if (random_number_engine == RandomNumberEngine::MT) {
-      return std::mt19937();
+}
+
+//! @brief 64-bit random number engine holding one of Philox4x32, Xoshiro256pp and PCG64 chosen at run time.
+//! The kernels of the integer and the parallel tempering samplers are instantiated once on this class for the three engines instead of once for each.
+//! The numbers are drawn in order from a block refilled by one std::visit, so that the indirect call is paid once per block and the stream is that of the held engine.
+class ErasedRandomNumberEngine {
+public:
+   //! @brief The type of random numbers.
+   using result_type = std::uint64_t;
+   
+   //! @brief The number of random numbers drawn at once from the held engine.
+   static constexpr std::size_t BLOCK_SIZE = 64;
+   
+   //! @brief Constructor.
+   //! @param random_number_engine The engine to be held.
+   template<class RandType>
+   explicit ErasedRandomNumberEngine(const RandType &random_number_engine): engine_(random_number_engine) {}
+   
+   inline static constexpr result_type min() { return 0u; }
+   
+   inline static constexpr result_type max() { return UINT64_MAX; }
+   
+   inline result_type operator()() {
+      if (index_ == BLOCK_SIZE) {
+         std::visit([this](auto &engine) {
+            for (auto &value: block_) {
+               value = engine();
+            }
+         }, engine_);
+         index_ = 0;
+      }
+      return block_[index_++];
    }
-   else if (random_number_engine == RandomNumberEngine::MT) {
-      return std::mt19937_64();
+   
+private:
+   std::variant<utility::Philox4x32, utility::Xoshiro256pp, utility::PCG64> engine_;
+   std::array<result_type, BLOCK_SIZE> block_;
+   std::size_t index_ = BLOCK_SIZE;
+   
+};
+
+//! @brief Call the function with the tag of the random number engine class as DispatchRandomNumberEngine does,
+//! except that PHILOX, XOSHIRO and PCG64 share ErasedRandomNumberEngine.
+//! The kernels dispatched here must construct the engines by MakeRandomNumberEngine.
+//! @param random_number_engine The random number engine.
+//! @param function Function taking RandomNumberEngineTag, whose return type must not depend on the engine.
+//! @return The return value of the function.
+template<class Function>
+decltype(auto) DispatchErasedRandomNumberEngine(const RandomNumberEngine random_number_engine, Function &&function) {
+   switch (random_number_engine) {
+      case RandomNumberEngine::XORSHIFT:
+         return function(RandomNumberEngineTag<utility::Xorshift>{});
+      case RandomNumberEngine::MT:
+         return function(RandomNumberEngineTag<std::mt19937>{});
+      case RandomNumberEngine::MT_64:
+         return function(RandomNumberEngineTag<std::mt19937_64>{});
+      case RandomNumberEngine::PHILOX:
+      case RandomNumberEngine::XOSHIRO:
+      case RandomNumberEngine::PCG64:
+         return function(RandomNumberEngineTag<ErasedRandomNumberEngine>{});
+      default:
+         throw std::runtime_error("Unknown RandomNumberEngine");
+   }
+}
+
+//! @brief Construct the random number engine of the class given by DispatchErasedRandomNumberEngine with a seed.
+//! @param random_number_engine The random number engine.
+//! @param seed The seed, which is cast to the result type of the engine.
+//! @return The random number engine.
+template<class RandType>
+RandType MakeRandomNumberEngine(const RandomNumberEngine random_number_engine, const std::uint64_t seed) {
+   if constexpr (std::is_same<RandType, ErasedRandomNumberEngine>::value) {
+      switch (random_number_engine) {
+         case RandomNumberEngine::PHILOX:
+            return RandType(utility::Philox4x32(seed));
+         case RandomNumberEngine::XOSHIRO:
+            return RandType(utility::Xoshiro256pp(seed));
+         case RandomNumberEngine::PCG64:
+            return RandType(utility::PCG64(seed));
+         default:
+            throw std::runtime_error("The random number engine is not held by ErasedRandomNumberEngine");
+      }
    }
    else {
-      throw std::runtime_error("Unknown RandomNumberEngine");
+      return RandType(static_cast<typename RandType::result_type>(seed));
    }
 }
 
+using RandomNumberEngineVariant = std::variant<utility::Xorshift, std::mt19937, std::mt19937_64,
+                                               utility::Philox4x32, utility::Xoshiro256pp, utility::PCG64>;
+
+//! @brief Generate the random number engine with the default seed.
+//! @param random_number_engine The random number engine.
+//! @return The random number engine.
+inline RandomNumberEngineVariant GenerateRandomNumberEngineClass(const RandomNumberEngine random_number_engine) {
+   return DispatchRandomNumberEngine(random_number_engine, [](auto tag) -> RandomNumberEngineVariant {
+      return typename decltype(tag)::type();
+   });
+}
+
+//! @brief Generate the random number engine with a seed.
+//! @param random_number_engine The random number engine.
+//! @param seed The seed.
+//! @return The random number engine.
+inline RandomNumberEngineVariant GenerateRandomNumberEngineClass(const RandomNumberEngine random_number_engine,
+                                                                 const std::uint64_t seed) {
+   return DispatchRandomNumberEngine(random_number_engine, [seed](auto tag) -> RandomNumberEngineVariant {
+      using RandType = typename decltype(tag)::type;
+      return RandType(static_cast<typename RandType::result_type>(seed));
+   });
+}
+
 } // namespace algorithm
 } // namespace openjij
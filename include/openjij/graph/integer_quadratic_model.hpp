@@ -44,7 +44,7 @@ public:
 
     this->num_variables_ = this->index_list_.size();
 
-    this->quadratic_.resize(this->num_variables_);
+    this->quadratic_offset_list_.assign(this->num_variables_ + 1, 0);
     this->linear_.resize(this->num_variables_, 0.0);
     this->squared_.resize(this->num_variables_, 0.0);
     this->constant_ = 0.0;
@@ -66,8 +66,8 @@ public:
         if (key[0] == key[1]) {
           this->squared_[key[0]] += value_list[i];
         } else {
-          this->quadratic_[key[0]].emplace_back(key[1], value_list[i]);
-          this->quadratic_[key[1]].emplace_back(key[0], value_list[i]);
+          this->quadratic_offset_list_[key[0] + 1]++;
+          this->quadratic_offset_list_[key[1] + 1]++;
         }
       }
     }
@@ -77,6 +77,26 @@ public:
         this->only_bilinear_index_set_.insert(i);
       }
     }
+
+    // The quadratic interactions are stored only in CSR arrays, which
+    // systems reference directly instead of copying the model. The
+    // interactions of each variable keep the order of key_list.
+    for (std::int64_t i = 0; i < this->num_variables_; ++i) {
+      this->quadratic_offset_list_[i + 1] += this->quadratic_offset_list_[i];
+    }
+    this->quadratic_index_list_.resize(this->quadratic_offset_list_.back());
+    this->quadratic_value_list_.resize(this->quadratic_offset_list_.back());
+    std::vector<std::size_t> position(this->quadratic_offset_list_.begin(),
+                                      this->quadratic_offset_list_.end() - 1);
+    for (std::size_t i = 0; i < key_list.size(); ++i) {
+      const auto &key = key_list[i];
+      if (key.size() == 2 && key[0] != key[1]) {
+        this->quadratic_index_list_[position[key[0]]] = key[1];
+        this->quadratic_value_list_[position[key[0]]++] = value_list[i];
+        this->quadratic_index_list_[position[key[1]]] = key[0];
+        this->quadratic_value_list_[position[key[1]]++] = value_list[i];
+      }
+    }
   }
 
   std::pair<double, double> GetMaxMinTerms() const {
@@ -112,7 +132,10 @@ public:
          min_nonzero_abs_i = 1.0;
        }
 
-       for (const auto &[j, q] : this->quadratic_[i]) {
+       for (std::size_t k = this->quadratic_offset_list_[i];
+            k < this->quadratic_offset_list_[i + 1]; ++k) {
+         const std::int64_t j = this->quadratic_index_list_[k];
+         const double q = this->quadratic_value_list_[k];
          const auto &bound_j = this->bounds_[j];
          const double max_abs_j = static_cast<double>(std::max(std::abs(bound_j.first), std::abs(bound_j.second)));
          
@@ -145,9 +168,31 @@ public:
 
   const std::vector<std::int64_t> &GetIndexList() const { return index_list_; }
   std::int64_t GetNumVariables() const { return num_variables_; }
-  const std::vector<std::vector<std::pair<std::int64_t, double>>> &
-  GetQuadratic() const {
-    return quadratic_;
+  // Build the nested list from the CSR arrays, which costs O(number of the
+  // quadratic terms) at each call
+  std::vector<std::vector<std::pair<std::int64_t, double>>>
+  BuildQuadratic() const {
+    std::vector<std::vector<std::pair<std::int64_t, double>>> quadratic(
+        num_variables_);
+    for (std::int64_t i = 0; i < num_variables_; ++i) {
+      quadratic[i].reserve(quadratic_offset_list_[i + 1] -
+                           quadratic_offset_list_[i]);
+      for (std::size_t k = quadratic_offset_list_[i];
+           k < quadratic_offset_list_[i + 1]; ++k) {
+        quadratic[i].emplace_back(quadratic_index_list_[k],
+                                  quadratic_value_list_[k]);
+      }
+    }
+    return quadratic;
+  }
+  const std::vector<std::size_t> &GetQuadraticOffsetList() const {
+    return quadratic_offset_list_;
+  }
+  const std::vector<std::int64_t> &GetQuadraticIndexList() const {
+    return quadratic_index_list_;
+  }
+  const std::vector<double> &GetQuadraticValueList() const {
+    return quadratic_value_list_;
   }
   const std::vector<double> &GetLinear() const { return linear_; }
   const std::vector<double> &GetSquared() const { return squared_; }
@@ -162,7 +207,9 @@ public:
 private:
   std::vector<std::int64_t> index_list_;
   std::int64_t num_variables_;
-  std::vector<std::vector<std::pair<std::int64_t, double>>> quadratic_;
+  std::vector<std::size_t> quadratic_offset_list_;
+  std::vector<std::int64_t> quadratic_index_list_;
+  std::vector<double> quadratic_value_list_;
   std::vector<double> linear_;
   std::vector<double> squared_;
   double constant_;
@@ -93,29 +93,21 @@ public:
          }
       }
       
-      key_value_list_.reserve(poly.size());
+      // Sort the interactions by keys, and compile them into the CSR arrays,
+      // which are the only copy of the interactions kept by the model.
+      std::vector<const typename decltype(poly)::value_type*> sorted_poly;
+      sorted_poly.reserve(poly.size());
       for (const auto &it: poly) {
-         key_value_list_.push_back({it.first, it.second});
+         sorted_poly.push_back(&it);
       }
-      
-      poly.clear();
-      
-      //Sort by keys.
-      std::sort(key_value_list_.begin(), key_value_list_.end(), [](const auto &a, const auto &b) {
-         return a.first < b.first;
+      std::sort(sorted_poly.begin(), sorted_poly.end(), [](const auto *a, const auto *b) {
+         return a->first < b->first;
       });
       
-      adjacency_list_.resize(system_size_);
-      for (std::size_t i = 0; i < key_value_list_.size(); ++i) {
-         for (const auto &index: key_value_list_[i].first) {
-            adjacency_list_[index].push_back(i);
-         }
-      }
+      SetCompressedInteractions(sorted_poly);
       
-      for (std::int32_t i = 0; i < system_size_; ++i) {
-         adjacency_list_[i].shrink_to_fit();
-         std::sort(adjacency_list_[i].begin(), adjacency_list_[i].end());
-      }
+      sorted_poly.clear();
+      poly.clear();
       
       // Set relevant absolute minimum interaction
       // Apply threshold to avoid extremely minimum interaction derived from numerical errors.
@@ -125,11 +117,12 @@ public:
       
       for (std::int32_t i = 0; i < system_size_; ++i) {
          ValueType abs_row_sum_interaction = 0;
-         for (const auto &interaction_index: adjacency_list_[i]) {
-            if (std::abs(key_value_list_[interaction_index].second) >= relevant_abs_min_interaction) {
-               abs_row_sum_interaction += std::abs(key_value_list_[interaction_index].second);
-               if (2*std::abs(key_value_list_[interaction_index].second) < estimated_min_energy_difference_) {
-                  estimated_min_energy_difference_ = 2*std::abs(key_value_list_[interaction_index].second);
+         for (std::size_t j = adjacency_offset_list_[i]; j < adjacency_offset_list_[i + 1]; ++j) {
+            const ValueType abs_interaction = std::abs(value_list_[adjacency_key_list_[j]]);
+            if (abs_interaction >= relevant_abs_min_interaction) {
+               abs_row_sum_interaction += abs_interaction;
+               if (2*abs_interaction < estimated_min_energy_difference_) {
+                  estimated_min_energy_difference_ = 2*abs_interaction;
                }
             }
          }
@@ -169,17 +162,61 @@ public:
       return index_map_;
    }
    
-   //! @brief Get the integer key and value list as pair.
+   //! @brief Build the integer key and value list as pair from the CSR arrays,
+   //! since the model keeps no nested copy of the interactions. This costs O(number of the terms) at each call.
    //! @return The integer key and value list as pair.
-   const std::vector<std::pair<std::vector<std::int32_t>, ValueType>> &GetKeyValueList() const {
-      return key_value_list_;
+   std::vector<std::pair<std::vector<std::int32_t>, ValueType>> BuildKeyValueList() const {
+      std::vector<std::pair<std::vector<std::int32_t>, ValueType>> key_value_list(value_list_.size());
+      for (std::size_t i = 0; i < value_list_.size(); ++i) {
+         key_value_list[i].first.assign(key_index_list_.begin() + key_offset_list_[i],
+                                        key_index_list_.begin() + key_offset_list_[i + 1]);
+         key_value_list[i].second = value_list_[i];
+      }
+      return key_value_list;
    }
    
-   //! @brief Get the adjacency list, which stored the integer index of
-   //! the polynomial interaction specified by the site index.
+   //! @brief Build the adjacency list, which stores the integer index of
+   //! the polynomial interaction specified by the site index, from the CSR arrays.
    //! @return The adjacency list.
-   const std::vector<std::vector<std::size_t>> &GetAdjacencyList() const {
-      return adjacency_list_;
+   std::vector<std::vector<std::size_t>> BuildAdjacencyList() const {
+      std::vector<std::vector<std::size_t>> adjacency_list(system_size_);
+      for (std::int32_t i = 0; i < system_size_; ++i) {
+         adjacency_list[i].assign(adjacency_key_list_.begin() + adjacency_offset_list_[i],
+                                  adjacency_key_list_.begin() + adjacency_offset_list_[i + 1]);
+      }
+      return adjacency_list;
+   }
+   
+   //! @brief Get the offsets of the keys in the flattened key index list.
+   //! The indices of the variables in the i-th interaction are stored in [offset[i], offset[i + 1]).
+   //! @return The key offset list, whose size is the number of the interactions plus one.
+   const std::vector<std::size_t> &GetKeyOffsetList() const {
+      return key_offset_list_;
+   }
+   
+   //! @brief Get the flattened indices of the variables in the interactions.
+   //! @return The key index list.
+   const std::vector<std::int32_t> &GetKeyIndexList() const {
+      return key_index_list_;
+   }
+   
+   //! @brief Get the values of the interactions, which are sorted by the keys.
+   //! @return The value list.
+   const std::vector<ValueType> &GetValueList() const {
+      return value_list_;
+   }
+   
+   //! @brief Get the offsets of the adjacency in the flattened adjacency key list (CSR format).
+   //! The interactions including the i-th variable are stored in [offset[i], offset[i + 1]).
+   //! @return The adjacency offset list, whose size is the system size plus one.
+   const std::vector<std::size_t> &GetAdjacencyOffsetList() const {
+      return adjacency_offset_list_;
+   }
+   
+   //! @brief Get the flattened integer indices of the interactions including each variable.
+   //! @return The adjacency key list.
+   const std::vector<std::int32_t> &GetAdjacencyKeyList() const {
+      return adjacency_key_list_;
    }
    
    //! @brief Get estimated minimum energy difference.
@@ -202,12 +239,12 @@ public:
          throw std::runtime_error("The size of variables is not equal to the system size");
       }
       ValueType val = 0.0;
-      for (std::size_t i = 0; i < key_value_list_.size(); ++i) {
+      for (std::size_t i = 0; i < value_list_.size(); ++i) {
          VariableType prod = 1;
-         for (const auto &index: key_value_list_[i].first) {
-            prod *= variables[index];
+         for (std::size_t j = key_offset_list_[i]; j < key_offset_list_[i + 1]; ++j) {
+            prod *= variables[key_index_list_[j]];
          }
-         val += key_value_list_[i].second*prod;
+         val += value_list_[i]*prod;
       }
       return val;
    }
@@ -226,12 +263,20 @@ private:
    //! @brief The mapping from the index to the integer.
    std::unordered_map<IndexType, std::int32_t, IndexHash> index_map_;
    
-   //! @brief The integer key and value list as pair.
-   std::vector<std::pair<std::vector<std::int32_t>, ValueType>> key_value_list_;
+   //! @brief The offsets of the keys in key_index_list_.
+   std::vector<std::size_t> key_offset_list_;
+   
+   //! @brief The flattened indices of the variables in the interactions.
+   std::vector<std::int32_t> key_index_list_;
+   
+   //! @brief The values of the interactions.
+   std::vector<ValueType> value_list_;
    
-   //! @brief The adjacency list, which stored the integer index of
-   //! the polynomial interaction specified by the site index.
-   std::vector<std::vector<std::size_t>> adjacency_list_;
+   //! @brief The offsets of the adjacency in adjacency_key_list_.
+   std::vector<std::size_t> adjacency_offset_list_;
+   
+   //! @brief The flattened integer indices of the interactions including each variable.
+   std::vector<std::int32_t> adjacency_key_list_;
    
    //! @brief The estimated minimum energy difference.
    ValueType estimated_min_energy_difference_ = 0;
@@ -243,6 +288,45 @@ private:
    //! \f[ {\rm ratio} = \frac{\Delat E_{{\rm min}}}{\Delat E_{{\rm max}}}\f]
    const ValueType min_max_energy_difference_ratio_ = 1e-08;
    
+   //! @brief Compile the interactions sorted by keys into the contiguous arrays,
+   //! which are traversed in the state update without chasing pointers.
+   //! @param sorted_poly The pointers to the pairs of the integer key and the value sorted by keys.
+   template<class PolyPointerList>
+   void SetCompressedInteractions(const PolyPointerList &sorted_poly) {
+      if (sorted_poly.size() > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max())) {
+         throw std::runtime_error("The number of interactions must be less than 2^31.");
+      }
+      
+      const std::size_t num_interactions = sorted_poly.size();
+      key_offset_list_.resize(num_interactions + 1);
+      value_list_.resize(num_interactions);
+      key_offset_list_[0] = 0;
+      for (std::size_t i = 0; i < num_interactions; ++i) {
+         key_offset_list_[i + 1] = key_offset_list_[i] + sorted_poly[i]->first.size();
+         value_list_[i] = sorted_poly[i]->second;
+      }
+      key_index_list_.resize(key_offset_list_.back());
+      for (std::size_t i = 0; i < num_interactions; ++i) {
+         std::copy(sorted_poly[i]->first.begin(), sorted_poly[i]->first.end(), key_index_list_.begin() + key_offset_list_[i]);
+      }
+      
+      // Counting sort of the interactions by variables, so that the interactions of each variable are in ascending order.
+      adjacency_offset_list_.assign(system_size_ + 1, 0);
+      for (const auto &index: key_index_list_) {
+         adjacency_offset_list_[index + 1]++;
+      }
+      for (std::int32_t i = 0; i < system_size_; ++i) {
+         adjacency_offset_list_[i + 1] += adjacency_offset_list_[i];
+      }
+      adjacency_key_list_.resize(adjacency_offset_list_.back());
+      std::vector<std::size_t> position(adjacency_offset_list_.begin(), adjacency_offset_list_.end() - 1);
+      for (std::size_t i = 0; i < num_interactions; ++i) {
+         for (std::size_t j = key_offset_list_[i]; j < key_offset_list_[i + 1]; ++j) {
+            adjacency_key_list_[position[key_index_list_[j]]++] = static_cast<std::int32_t>(i);
+         }
+      }
+   }
+   
 };
 
 }
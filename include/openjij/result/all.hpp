@@ -14,4 +14,5 @@
 
 #pragma once
 
+#include "openjij/result/get_energy.hpp"
 #include "openjij/result/get_solution.hpp"
@@ -0,0 +1,94 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "openjij/graph/all.hpp"
+#include "openjij/system/all.hpp"
+
+namespace openjij {
+namespace result {
+
+/**
+ * @brief get energy of classical ising system.
+ * The energy \f$ (s^T J s - \mathrm{tr} J)/2 \f$ is tracked by the system
+ * as the spins are updated, so no full evaluation is needed.
+ *
+ * @tparam GraphType graph type
+ * @param system classical ising system with Eigen implementation
+ *
+ * @return energy of the current spin configuration
+ */
+template <typename GraphType>
+double get_energy(const system::ClassicalIsing<GraphType> &system) {
+  return system.energy;
+}
+
+/**
+ * @brief get energy of classical ising system with compact storage
+ *
+ * @tparam GraphType graph type
+ * @tparam StorageType type of the stored interactions
+ * @param system classical ising system with compact storage
+ *
+ * @return energy tracked by the updaters
+ */
+template <typename GraphType, typename StorageType>
+double get_energy(
+    const system::CompactClassicalIsing<GraphType, StorageType> &system) {
+  return system.energy;
+}
+
+/**
+ * @brief get energies of replica-packed classical ising system
+ *
+ * @tparam GraphType graph type
+ * @param system replica-packed classical ising system
+ *
+ * @return energy tracked by the updaters of each replica
+ */
+template <typename GraphType>
+std::vector<double>
+get_energy(const system::ReplicaPackedClassicalIsing<GraphType> &system) {
+  return std::vector<double>(system.energy.data(),
+                             system.energy.data() + system.num_replicas);
+}
+
+/**
+ * @brief get energy of transverse ising system.
+ * The classical energy of the trotter slice chosen by get_solution is
+ * returned.
+ *
+ * @tparam GraphType graph type
+ * @param system transverse ising system with Eigen implementation
+ *
+ * @return minimum classical energy over trotter slices
+ */
+template <typename GraphType>
+double get_energy(const system::TransverseIsing<GraphType> &system) {
+  // aliases
+  const auto &spins = system.trotter_spins;
+  double min_energy = std::numeric_limits<double>::max();
+  for (std::size_t t = 0; t < static_cast<std::size_t>(spins.cols()); t++) {
+    const double energy = spins.col(t).dot(system.interaction * spins.col(t));
+    min_energy = std::min(min_energy, energy);
+  }
+  return (min_energy - system.interaction.diagonal().sum()) / 2.0;
+}
+
+} // namespace result
+} // namespace openjij
@@ -48,6 +48,48 @@ get_solution(const system::ClassicalIsing<GraphType> &system) {
   return ret_spins;
 }
 
+/**
+ * @brief get solution of classical ising system with compact storage
+ *
+ * @tparam GraphType graph type
+ * @tparam StorageType type of the stored interactions
+ * @param system classical ising system with compact storage
+ *
+ * @return solution
+ */
+template <typename GraphType, typename StorageType>
+const graph::Spins get_solution(
+    const system::CompactClassicalIsing<GraphType, StorageType> &system) {
+  graph::Spins ret_spins(system.num_spins);
+  for (std::size_t i = 0; i < system.num_spins; i++) {
+    ret_spins[i] = static_cast<graph::Spin>(system.spin[i] *
+                                            system.spin[system.num_spins]);
+  }
+  return ret_spins;
+}
+
+/**
+ * @brief get solutions of replica-packed classical ising system
+ *
+ * @tparam GraphType graph type
+ * @param system replica-packed classical ising system
+ *
+ * @return solution of each replica
+ */
+template <typename GraphType>
+const std::vector<graph::Spins>
+get_solution(const system::ReplicaPackedClassicalIsing<GraphType> &system) {
+  std::vector<graph::Spins> ret_spins(system.num_replicas,
+                                      graph::Spins(system.num_spins));
+  for (std::size_t r = 0; r < system.num_replicas; r++) {
+    for (std::size_t i = 0; i < system.num_spins; i++) {
+      ret_spins[r][i] = static_cast<graph::Spin>(
+          system.spin(i, r) * system.spin(system.num_spins, r));
+    }
+  }
+  return ret_spins;
+}
+
 /**
  * @brief get solution of transverse ising system
  *
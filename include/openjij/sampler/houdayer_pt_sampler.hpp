@@ -0,0 +1,416 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "openjij/graph/all.hpp"
+#include "openjij/system/all.hpp"
+#include "openjij/updater/all.hpp"
+#include "openjij/result/all.hpp"
+
+namespace openjij {
+namespace sampler {
+
+//! @brief Class for executing parallel tempering with Houdayer isoenergetic cluster moves on sparse Ising models.
+//! Each read runs two replicas at each inverse temperature of a geometric ladder, which are updated by the single spin flip.
+//! After every exchange interval, the two replicas at each inverse temperature are updated by a Houdayer cluster move,
+//! and the replicas at adjacent inverse temperatures are exchanged within each of the two ladders.
+//! The Houdayer moves mix the low-dimensional spin glasses, such as those on graph::Square and graph::Chimera,
+//! much faster than the single spin flip alone.
+//! @tparam FloatType The type of floating-point.
+template<typename FloatType>
+class HoudayerPTSampler {
+
+   //! @brief The system type.
+   using SystemType = system::ClassicalIsing<graph::CSRSparse<FloatType>>;
+
+public:
+   //! @brief Constructor for HoudayerPTSampler class.
+   //! @param graph The interactions in the CSR format.
+   HoudayerPTSampler(const graph::CSRSparse<FloatType> &graph): graph_(graph) {}
+
+   //! @brief Constructor for HoudayerPTSampler class, which converts the interactions to the CSR format.
+   //! @param graph The sparse interactions, which may be graph::Square or graph::Chimera.
+   HoudayerPTSampler(const graph::Sparse<FloatType> &graph): graph_(GenerateCSRSparse(graph)) {}
+
+   //! @brief Set the number of sweeps of each replica.
+   //! @param num_sweeps The number of sweeps, which must be larger than zero.
+   void SetNumSweeps(const std::int32_t num_sweeps) {
+      if (num_sweeps <= 0) {
+         throw std::runtime_error("num_sweeps must be larger than zero.");
+      }
+      num_sweeps_ = num_sweeps;
+   }
+
+   //! @brief Set the number of samples.
+   //! @param num_reads The number of samples, which must be larger than zero.
+   void SetNumReads(const std::int32_t num_reads) {
+      if (num_reads <= 0) {
+         throw std::runtime_error("num_reads must be larger than zero.");
+      }
+      num_reads_ = num_reads;
+   }
+
+   //! @brief Set the number of inverse temperatures in the ladder, each of which holds two replicas.
+   //! @param num_temperatures The number of inverse temperatures, which must be larger than one.
+   void SetNumTemperatures(const std::int32_t num_temperatures) {
+      if (num_temperatures <= 1) {
+         throw std::runtime_error("num_temperatures must be larger than one.");
+      }
+      num_temperatures_ = num_temperatures;
+   }
+
+   //! @brief Set the number of sweeps between the cluster moves and the exchange steps.
+   //! @param exchange_interval The number of sweeps, which must be larger than zero.
+   void SetExchangeInterval(const std::int32_t exchange_interval) {
+      if (exchange_interval <= 0) {
+         throw std::runtime_error("exchange_interval must be larger than zero.");
+      }
+      exchange_interval_ = exchange_interval;
+   }
+
+   //! @brief Set the number of threads in the calculation.
+   //! @param num_threads The number of threads in the calculation, which must be larger than zero.
+   void SetNumThreads(const std::int32_t num_threads) {
+      if (num_threads <= 0) {
+         throw std::runtime_error("num_threads must be non-negative integer.");
+      }
+      num_threads_ = num_threads;
+   }
+
+   //! @brief Set the minimum inverse temperature.
+   //! @param beta_min The minimum inverse temperature, which must be larger than zero.
+   void SetBetaMin(const FloatType beta_min) {
+      if (beta_min <= 0) {
+         throw std::runtime_error("beta_min must be positive number");
+      }
+      beta_min_ = beta_min;
+   }
+
+   //! @brief Set the maximum inverse temperature.
+   //! @param beta_max The maximum inverse temperature, which must be larger than zero.
+   void SetBetaMax(const FloatType beta_max) {
+      if (beta_max <= 0) {
+         throw std::runtime_error("beta_max must be positive number");
+      }
+      beta_max_ = beta_max;
+   }
+
+   //! @brief Set the smallest inverse temperature at which the Houdayer moves are applied.
+   //! In three or more dimensions the clusters percolate at high temperatures, where the moves only flip almost all the spins.
+   //! @param houdayer_beta_min The inverse temperature, which must be non-negative. Zero applies the moves at all the inverse temperatures.
+   void SetHoudayerBetaMin(const FloatType houdayer_beta_min) {
+      if (houdayer_beta_min < 0) {
+         throw std::runtime_error("houdayer_beta_min must be non-negative number");
+      }
+      houdayer_beta_min_ = houdayer_beta_min;
+   }
+
+   //! @brief Set random number engine for updating initializing state.
+   //! @param random_number_engine The random number engine.
+   void SetRandomNumberEngine(const algorithm::RandomNumberEngine random_number_engine) {
+      random_number_engine_ = random_number_engine;
+   }
+
+   //! @brief Get the interactions.
+   //! @return The interactions.
+   const graph::CSRSparse<FloatType> &GetGraph() const {
+      return graph_;
+   }
+
+   //! @brief Get the number of sweeps of each replica.
+   //! @return The number of sweeps.
+   std::int32_t GetNumSweeps() const {
+      return num_sweeps_;
+   }
+
+   //! @brief Get the number of reads.
+   //! @return The number of reads.
+   std::int32_t GetNumReads() const {
+      return num_reads_;
+   }
+
+   //! @brief Get the number of inverse temperatures.
+   //! @return The number of inverse temperatures.
+   std::int32_t GetNumTemperatures() const {
+      return num_temperatures_;
+   }
+
+   //! @brief Get the number of sweeps between the cluster moves and the exchange steps.
+   //! @return The number of sweeps.
+   std::int32_t GetExchangeInterval() const {
+      return exchange_interval_;
+   }
+
+   //! @brief Get the number of threads.
+   //! @return The number of threads.
+   std::int32_t GetNumThreads() const {
+      return num_threads_;
+   }
+
+   //! @brief Get the minimum inverse temperature.
+   //! @return The minimum inverse temperature.
+   FloatType GetBetaMin() const {
+      return beta_min_;
+   }
+
+   //! @brief Get the maximum inverse temperature.
+   //! @return The maximum inverse temperature.
+   FloatType GetBetaMax() const {
+      return beta_max_;
+   }
+
+   //! @brief Get the smallest inverse temperature at which the Houdayer moves are applied.
+   //! @return The inverse temperature.
+   FloatType GetHoudayerBetaMin() const {
+      return houdayer_beta_min_;
+   }
+
+   //! @brief Get the random number engine for updating and initializing state.
+   //! @return The random number engine for updating and initializing state.
+   algorithm::RandomNumberEngine GetRandomNumberEngine() const {
+      return random_number_engine_;
+   }
+
+   //! @brief Get the seed to be used in the calculation.
+   //! @return The seed.
+   std::uint64_t GetSeed() const {
+      return seed_;
+   }
+
+   //! @brief Get the inverse temperature ladder.
+   //! @return The inverse temperatures in ascending order.
+   const std::vector<FloatType> &GetBetaList() const {
+      return beta_list_;
+   }
+
+   //! @brief Get the exchange acceptance rates between adjacent inverse temperatures in the last read.
+   //! @return The acceptance rates, whose size is the number of inverse temperatures minus one.
+   const std::vector<double> &GetExchangeAcceptanceRates() const {
+      return exchange_acceptance_rates_;
+   }
+
+   //! @brief Get the mean size of the clusters flipped by the Houdayer moves at each inverse temperature in the last read.
+   //! @return The mean cluster sizes, which are zero at the inverse temperatures without the moves.
+   const std::vector<double> &GetMeanClusterSizes() const {
+      return mean_cluster_sizes_;
+   }
+
+   //! @brief Get the samples.
+   //! Each sample is the lowest energy state visited by any replica at the exchange steps.
+   //! @return The samples.
+   const std::vector<graph::Spins> &GetSamples() const {
+      return samples_;
+   }
+
+   std::vector<FloatType> CalculateEnergies() const {
+      if (samples_.size() == 0) {
+         throw std::runtime_error("The sample size is zero. It seems that sampling has not been carried out.");
+      }
+      std::vector<FloatType> energies(num_reads_);
+      for (std::int32_t i = 0; i < num_reads_; ++i) {
+         energies[i] = graph_.energy(samples_[i]);
+      }
+      return energies;
+   }
+
+   //! @brief Execute sampling.
+   //! Seed to be used in the calculation will be set automatically.
+   void Sample() {
+      Sample(std::random_device()());
+   }
+
+   //! @brief Execute sampling.
+   //! @param seed The seed to be used in the calculation.
+   void Sample(const std::uint64_t seed) {
+      if (beta_min_ > beta_max_) {
+         throw std::runtime_error("beta_min must not be larger than beta_max.");
+      }
+      seed_ = seed;
+
+      samples_.clear();
+      samples_.shrink_to_fit();
+      samples_.resize(num_reads_);
+
+      algorithm::DispatchErasedRandomNumberEngine(random_number_engine_, [this](auto tag) {
+         using RandType = typename decltype(tag)::type;
+         TemplateSampler<RandType>();
+      });
+   }
+
+private:
+   //! @brief The interactions.
+   const graph::CSRSparse<FloatType> graph_;
+
+   //! @brief The number of sweeps of each replica.
+   std::int32_t num_sweeps_ = 1000;
+
+   //! @brief The number of reads (samples).
+   std::int32_t num_reads_ = 1;
+
+   //! @brief The number of inverse temperatures in the ladder.
+   std::int32_t num_temperatures_ = 16;
+
+   //! @brief The number of sweeps between the cluster moves and the exchange steps.
+   std::int32_t exchange_interval_ = 1;
+
+   //! @brief The number of threads in the calculation.
+   std::int32_t num_threads_ = 1;
+
+   //! @brief The minimum inverse temperature.
+   FloatType beta_min_ = 0.1;
+
+   //! @brief The maximum inverse temperature.
+   FloatType beta_max_ = 3;
+
+   //! @brief The smallest inverse temperature at which the Houdayer moves are applied.
+   FloatType houdayer_beta_min_ = 0;
+
+   //! @brief Random number engine for updating and initializing state.
+   algorithm::RandomNumberEngine random_number_engine_ = algorithm::RandomNumberEngine::XORSHIFT;
+
+   //! @brief The seed to be used in the calculation.
+   std::uint64_t seed_ = std::random_device()();
+
+   //! @brief The inverse temperature ladder.
+   std::vector<FloatType> beta_list_;
+
+   //! @brief The exchange acceptance rates in the last read.
+   std::vector<double> exchange_acceptance_rates_;
+
+   //! @brief The mean cluster sizes in the last read.
+   std::vector<double> mean_cluster_sizes_;
+
+   //! @brief The samples.
+   std::vector<graph::Spins> samples_;
+
+   //! @brief Convert sparse interactions to the CSR format.
+   //! @param graph The sparse interactions.
+   //! @return The interactions in the CSR format.
+   static graph::CSRSparse<FloatType> GenerateCSRSparse(const graph::Sparse<FloatType> &graph) {
+      const Eigen::SparseMatrix<FloatType, Eigen::RowMajor> interaction = utility::gen_matrix_from_graph<Eigen::RowMajor>(graph);
+      return graph::CSRSparse<FloatType>(interaction.template triangularView<Eigen::Upper>());
+   }
+
+   template<class RandType>
+   void TemplateSampler() {
+      auto read_random_number_engine = algorithm::MakeRandomNumberEngine<RandType>(random_number_engine_, seed_);
+
+      const std::int32_t num_systems = 2*num_temperatures_;
+      beta_list_ = utility::GenerateBetaList(utility::TemperatureSchedule::GEOMETRIC, beta_min_, beta_max_, num_temperatures_);
+
+      for (std::int32_t read = 0; read < num_reads_; ++read) {
+         auto random_number_engine = algorithm::MakeRandomNumberEngine<RandType>(random_number_engine_, read_random_number_engine());
+         std::uniform_real_distribution<double> dist_real(0, 1);
+
+         // Replicas and their own random number engines, which move along the ladders together
+         std::vector<SystemType> system_list;
+         std::vector<RandType> system_random_number_engine_list;
+         system_list.reserve(num_systems);
+         system_random_number_engine_list.reserve(num_systems);
+         for (std::int32_t j = 0; j < num_systems; ++j) {
+            auto spin_random_number_engine = algorithm::MakeRandomNumberEngine<RandType>(random_number_engine_, random_number_engine());
+            system_list.emplace_back(graph_.gen_spin(spin_random_number_engine), graph_);
+            system_random_number_engine_list.push_back(algorithm::MakeRandomNumberEngine<RandType>(random_number_engine_, random_number_engine()));
+         }
+
+         // system_index[2*k + l] is the replica of the l-th ladder at the k-th inverse temperature
+         std::vector<std::int32_t> system_index(num_systems);
+         std::iota(system_index.begin(), system_index.end(), 0);
+
+         std::vector<std::int32_t> num_accepted(num_temperatures_ - 1, 0);
+         std::vector<std::int32_t> num_attempted(num_temperatures_ - 1, 0);
+         std::vector<std::int64_t> cluster_size_sum(num_temperatures_, 0);
+
+         FloatType min_energy = std::numeric_limits<FloatType>::max();
+         graph::Spins min_sample;
+
+         const std::int32_t num_rounds = (num_sweeps_ + exchange_interval_ - 1)/exchange_interval_;
+
+         for (std::int32_t round = 0; round < num_rounds; ++round) {
+            const std::int32_t num_sweeps = std::min(exchange_interval_, num_sweeps_ - round*exchange_interval_);
+
+#pragma omp parallel for schedule(static) num_threads(num_threads_)
+            for (std::int32_t m = 0; m < num_systems; ++m) {
+               const std::int32_t j = system_index[m];
+               const utility::ClassicalUpdaterParameter parameter(beta_list_[m/2]);
+               for (std::int32_t sweep = 0; sweep < num_sweeps; ++sweep) {
+                  updater::SingleSpinFlip<SystemType>::update(system_list[j], system_random_number_engine_list[j], parameter);
+               }
+            }
+
+            // The pair at each inverse temperature uses the engine of its first replica
+#pragma omp parallel for schedule(static) num_threads(num_threads_)
+            for (std::int32_t k = 0; k < num_temperatures_; ++k) {
+               if (beta_list_[k] >= houdayer_beta_min_) {
+                  const std::int32_t j = system_index[2*k];
+                  cluster_size_sum[k] += updater::Houdayer<SystemType>::update(system_list[j], system_list[system_index[2*k + 1]], system_random_number_engine_list[j]);
+               }
+            }
+
+            for (std::int32_t m = 0; m < num_systems; ++m) {
+               const auto &system = system_list[system_index[m]];
+               if (system.energy < min_energy) {
+                  min_energy = system.energy;
+                  min_sample = result::get_solution(system);
+               }
+            }
+
+            // Exchange the replicas at even and odd pairs alternately in each ladder
+            for (std::int32_t k = round % 2; k < num_temperatures_ - 1; k += 2) {
+               for (std::int32_t l = 0; l < 2; ++l) {
+                  auto &index = system_index[2*k + l];
+                  auto &next_index = system_index[2*(k + 1) + l];
+                  const FloatType delta = (beta_list_[k] - beta_list_[k + 1])*(system_list[index].energy - system_list[next_index].energy);
+                  num_attempted[k]++;
+                  if (delta >= 0 || std::exp(delta) > dist_real(random_number_engine)) {
+                     std::swap(index, next_index);
+                     num_accepted[k]++;
+                  }
+               }
+            }
+         }
+
+         samples_[read] = min_sample;
+         exchange_acceptance_rates_.resize(num_temperatures_ - 1);
+         for (std::int32_t k = 0; k < num_temperatures_ - 1; ++k) {
+            exchange_acceptance_rates_[k] = static_cast<double>(num_accepted[k])/std::max(num_attempted[k], 1);
+         }
+         mean_cluster_sizes_.resize(num_temperatures_);
+         for (std::int32_t k = 0; k < num_temperatures_; ++k) {
+            mean_cluster_sizes_[k] = static_cast<double>(cluster_size_sum[k])/num_rounds;
+         }
+      }
+   }
+
+};
+
+template<typename FloatType>
+auto make_houdayer_pt_sampler(const graph::CSRSparse<FloatType> &graph) {
+   return HoudayerPTSampler<FloatType>{graph};
+};
+
+template<typename FloatType>
+auto make_houdayer_pt_sampler(const graph::Sparse<FloatType> &graph) {
+   return HoudayerPTSampler<FloatType>{graph};
+};
+
+
+} //sampler
+} //openjij
@@ -17,6 +17,14 @@
 #include "openjij/graph/all.hpp"
 #include "openjij/system/all.hpp"
 #include "openjij/updater/all.hpp"
+#include "openjij/utility/graph_coloring.hpp"
+#include "openjij/utility/random.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
 
 namespace openjij {
 namespace sampler {
@@ -28,40 +36,182 @@ struct IntegerSAResult {
   std::vector<double> temperature_history = {};
 };
 
+struct IntegerSASampleSet {
+  std::int64_t num_variables = 0;
+  // Row-major buffer of (the number of samples) x num_variables
+  std::shared_ptr<std::vector<std::int64_t>> solution_buffer =
+      std::make_shared<std::vector<std::int64_t>>();
+  std::vector<double> energies = {};
+  std::vector<std::vector<double>> energy_history = {};
+  std::vector<std::vector<double>> temperature_history = {};
+};
+
+using Deadline = std::chrono::steady_clock::time_point;
+
+// Temperature of each sweep, which decreases from max_T to min_T. LINEAR is
+// linear in the temperature, while the other schedules are those of
+// utility::GenerateBetaList between 1/max_T and 1/min_T. power_law_exponent
+// and plateau_ratio are the parameters of POWER_LAW and EXPONENTIAL_PLATEAU.
+inline std::vector<double>
+GenerateTemperatureList(const utility::TemperatureSchedule schedule,
+                        const std::int64_t num_sweeps, const double min_T,
+                        const double max_T,
+                        const double power_law_exponent = 2,
+                        const double plateau_ratio = 0.5) {
+  if (!(power_law_exponent > 0)) {
+    throw std::runtime_error("power_law_exponent must be larger than zero.");
+  }
+  if (!(0 <= plateau_ratio && plateau_ratio < 1)) {
+    throw std::runtime_error("plateau_ratio must be in [0, 1).");
+  }
+  if (num_sweeps == 1) {
+    return std::vector<double>{max_T};
+  }
+  std::vector<double> temperature_list(num_sweeps);
+  if (schedule == utility::TemperatureSchedule::LINEAR) {
+    for (std::int64_t sweep = 0; sweep < num_sweeps; ++sweep) {
+      temperature_list[sweep] =
+          max_T +
+          (min_T - max_T) * (static_cast<double>(sweep) / (num_sweeps - 1));
+    }
+  } else if (schedule == utility::TemperatureSchedule::GEOMETRIC) {
+    for (std::int64_t sweep = 0; sweep < num_sweeps; ++sweep) {
+      temperature_list[sweep] =
+          max_T * std::pow(min_T / max_T,
+                           static_cast<double>(sweep) / (num_sweeps - 1));
+    }
+  } else {
+    const auto beta_list = utility::GenerateBetaList(
+        schedule, 1.0 / max_T, 1.0 / min_T,
+        static_cast<std::int32_t>(num_sweeps), power_law_exponent,
+        plateau_ratio);
+    for (std::int64_t sweep = 0; sweep < num_sweeps; ++sweep) {
+      temperature_list[sweep] = 1.0 / beta_list[sweep];
+    }
+  }
+  return temperature_list;
+}
+
+// Temperature of each sweep given by the inverse temperatures, where beta = 0
+// is the infinite temperature
+inline std::vector<double>
+ConvertBetaListToTemperatureList(const std::vector<double> &beta_list) {
+  std::vector<double> temperature_list(beta_list.size());
+  for (std::size_t sweep = 0; sweep < beta_list.size(); ++sweep) {
+    if (!(beta_list[sweep] >= 0)) {
+      throw std::runtime_error("beta must be non-negative number.");
+    }
+    temperature_list[sweep] =
+        beta_list[sweep] > 0 ? 1.0 / beta_list[sweep]
+                             : std::numeric_limits<double>::infinity();
+  }
+  return temperature_list;
+}
+
+// Variables of the same color share no interaction, so that their new values
+// can be decided at the same time
+inline std::vector<std::vector<std::int64_t>>
+GenerateColorList(const graph::IntegerQuadraticModel &model) {
+  const auto &offset_list = model.GetQuadraticOffsetList();
+  const auto &index_list = model.GetQuadraticIndexList();
+  std::vector<std::vector<std::int64_t>> neighbor_list(
+      model.GetNumVariables());
+  for (std::int64_t i = 0; i < model.GetNumVariables(); ++i) {
+    neighbor_list[i].assign(index_list.begin() + offset_list[i],
+                            index_list.begin() + offset_list[i + 1]);
+  }
+  return utility::GreedyColoring(neighbor_list);
+}
+
+// Variables appearing in the same term are neighbors
+inline std::vector<std::vector<std::int64_t>>
+GenerateColorList(const graph::IntegerPolynomialModel &model) {
+  std::vector<std::vector<std::int64_t>> neighbor_list(
+      model.GetNumVariables());
+  for (const auto &[key, _] : model.GetKeyValueList()) {
+    for (const auto &[i, _i] : key) {
+      for (const auto &[j, _j] : key) {
+        if (i != j) {
+          neighbor_list[i].push_back(j);
+        }
+      }
+    }
+  }
+  for (auto &neighbors : neighbor_list) {
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                    neighbors.end());
+  }
+  return utility::GreedyColoring(neighbor_list);
+}
+
 template <class ModelType, class RandType, class StateUpdater>
 IntegerSAResult
-BaseSA(const ModelType &model, const utility::TemperatureSchedule schedule,
-       const std::int64_t num_sweeps, const typename RandType::result_type seed,
-       const double min_T, const double max_T, const bool log_history) {
+BaseSA(const ModelType &model, const std::vector<double> &temperature_list,
+       const algorithm::RandomNumberEngine rand_type,
+       const typename RandType::result_type seed, const bool log_history,
+       const Deadline deadline = Deadline::max(),
+       const double target_energy = -std::numeric_limits<double>::infinity(),
+       std::int64_t *solution = nullptr,
+       const std::vector<std::vector<std::int64_t>> *color_list = nullptr,
+       const std::int32_t num_threads = 1, const bool fast_acceptance = false) {
 
   // Initialize the system
-  system::IntegerSASystem<ModelType, RandType> sa_system(model, seed);
+  system::IntegerSASystem<ModelType, RandType> sa_system(
+      model, seed,
+      algorithm::MakeRandomNumberEngine<RandType>(rand_type, seed));
 
   // Initialize the updater
   auto state_updater = StateUpdater{};
+  state_updater.fast_acceptance = fast_acceptance;
 
-  auto get_T = [&](const std::int64_t sweep) {
-    if (schedule == utility::TemperatureSchedule::LINEAR) {
-      return max_T +
-             (min_T - max_T) * (static_cast<double>(sweep) / (num_sweeps - 1));
-    } else if (schedule == utility::TemperatureSchedule::GEOMETRIC) {
-      return max_T * std::pow(min_T / max_T,
-                              static_cast<double>(sweep) / (num_sweeps - 1));
-    } else {
-      throw std::runtime_error("Unknown temperature schedule");
-    }
-  };
-
+  const std::int64_t num_sweeps =
+      static_cast<std::int64_t>(temperature_list.size());
   const std::int64_t num_variables = model.GetNumVariables();
   IntegerSAResult result;
 
   for (std::int64_t sweep = 0; sweep < num_sweeps; ++sweep) {
-    const double T = get_T(sweep);
-    const double progress = static_cast<double>(sweep) / (num_sweeps - 1);
-    for (std::int64_t i = 0; i < num_variables; ++i) {
-      const auto new_x =
-          state_updater.GenerateNewValue(sa_system, i, T, progress);
-      sa_system.SetValue(i, new_x);
+    // Stop early once the target energy is reached or the time is up
+    if (sa_system.GetEnergy() <= target_energy ||
+        (deadline != Deadline::max() &&
+         std::chrono::steady_clock::now() >= deadline)) {
+      break;
+    }
+    const double T = temperature_list[sweep];
+    const double progress =
+        num_sweeps > 1 ? static_cast<double>(sweep) / (num_sweeps - 1) : 0.0;
+    if (color_list == nullptr) {
+      for (std::int64_t i = 0; i < num_variables; ++i) {
+        const auto new_x =
+            state_updater.GenerateNewValue(sa_system, i, T, progress);
+        sa_system.SetValue(i, new_x);
+      }
+    } else {
+      // The variables of a color are updated in parallel, each with its own
+      // counter-based stream. They share no term, so their new values do not
+      // depend on each other, and only the coefficients of the shared
+      // neighbors are added atomically. The result depends on num_threads
+      // only through the rounding order of these additions.
+      for (const auto &color : *color_list) {
+        const std::int64_t num_color_variables =
+            static_cast<std::int64_t>(color.size());
+        const std::uint64_t key = sa_system.random_number_engine();
+#pragma omp parallel num_threads(num_threads)
+        {
+          auto updater = state_updater;
+#pragma omp for
+          for (std::int64_t k = 0; k < num_color_variables; ++k) {
+            utility::Philox4x32 engine(key, static_cast<std::uint64_t>(k));
+            const auto new_x = updater.GenerateNewValue(
+                sa_system, color[k], T, progress, engine);
+            if (num_threads == 1) {
+              sa_system.SetValue(color[k], new_x);
+            } else {
+              sa_system.template SetValue<true>(color[k], new_x);
+            }
+          }
+        }
+      }
     }
     if (log_history) {
       result.energy_history.push_back(sa_system.GetEnergy());
@@ -69,11 +219,15 @@ BaseSA(const ModelType &model, const utility::TemperatureSchedule schedule,
     }
   }
 
+  // The solution is written to the given buffer if any
   result.energy = sa_system.GetEnergy();
-  result.solution.resize(num_variables);
+  if (solution == nullptr) {
+    result.solution.resize(num_variables);
+    solution = result.solution.data();
+  }
   const auto &state = sa_system.GetState();
   for (std::int64_t i = 0; i < num_variables; ++i) {
-    result.solution[i] = state[i].value;
+    solution[i] = state[i].value;
   }
 
   return result;
@@ -81,57 +235,194 @@ BaseSA(const ModelType &model, const utility::TemperatureSchedule schedule,
 
 template <class ModelType, class UpdaterType>
 IntegerSAResult SolveByIntegerSAImpl(const ModelType &model,
-                                     const std::int64_t num_sweeps,
+                                     const std::vector<double> &temperature_list,
                                      const algorithm::RandomNumberEngine rand_type,
-                                     const utility::TemperatureSchedule schedule,
-                                     const std::int64_t seed, const double min_T,
-                                     const double max_T, const bool log_history) {
-  switch (rand_type) {
-  case algorithm::RandomNumberEngine::XORSHIFT:
-    return BaseSA<ModelType, utility::Xorshift, UpdaterType>(
-        model, schedule, num_sweeps,
-        static_cast<utility::Xorshift::result_type>(seed), min_T, max_T,
-        log_history);
-  case algorithm::RandomNumberEngine::MT:
-    return BaseSA<ModelType, std::mt19937, UpdaterType>(
-        model, schedule, num_sweeps,
-        static_cast<std::mt19937::result_type>(seed), min_T, max_T,
-        log_history);
-  case algorithm::RandomNumberEngine::MT_64:
-    return BaseSA<ModelType, std::mt19937_64, UpdaterType>(
-        model, schedule, num_sweeps, seed, min_T, max_T, log_history);
-  default:
-    throw std::runtime_error("Unknown random number engine");
-  }
+                                     const std::int64_t seed,
+                                     const bool log_history,
+                                     const Deadline deadline,
+                                     const double target_energy,
+                                     std::int64_t *solution,
+                                     const std::vector<std::vector<std::int64_t>>
+                                         *color_list = nullptr,
+                                     const std::int32_t num_threads = 1,
+                                     const bool fast_acceptance = false) {
+  return algorithm::DispatchErasedRandomNumberEngine(rand_type, [&](auto tag) {
+    using RandType = typename decltype(tag)::type;
+    return BaseSA<ModelType, RandType, UpdaterType>(
+        model, temperature_list, rand_type,
+        static_cast<typename RandType::result_type>(seed), log_history,
+        deadline, target_energy, solution, color_list, num_threads,
+        fast_acceptance);
+  });
 }
 
 template <class ModelType>
-IntegerSAResult SolveByIntegerSA(const ModelType &model,
-                                 const std::int64_t num_sweeps,
-                                 const algorithm::UpdateMethod update_method,
-                                 const algorithm::RandomNumberEngine rand_type,
-                                 const utility::TemperatureSchedule schedule,
-                                 const std::int64_t seed, const double min_T,
-                                 const double max_T, const bool log_history) {
+IntegerSAResult SolveByTemperatureList(
+    const ModelType &model, const std::vector<double> &temperature_list,
+    const algorithm::UpdateMethod update_method,
+    const algorithm::RandomNumberEngine rand_type, const std::int64_t seed,
+    const bool log_history, const Deadline deadline,
+    const double target_energy, std::int64_t *solution,
+    const std::vector<std::vector<std::int64_t>> *color_list = nullptr,
+    const std::int32_t num_threads = 1, const bool fast_acceptance = false) {
 
   switch (update_method) {
   case algorithm::UpdateMethod::METROPOLIS:
     return SolveByIntegerSAImpl<ModelType, updater::MetropolisUpdater>(
-        model, num_sweeps, rand_type, schedule, seed, min_T, max_T, log_history);
+        model, temperature_list, rand_type, seed, log_history, deadline,
+        target_energy, solution, color_list, num_threads, fast_acceptance);
   case algorithm::UpdateMethod::HEAT_BATH:
     return SolveByIntegerSAImpl<ModelType, updater::HeatBathUpdater>(
-        model, num_sweeps, rand_type, schedule, seed, min_T, max_T, log_history);
+        model, temperature_list, rand_type, seed, log_history, deadline,
+        target_energy, solution, color_list, num_threads, fast_acceptance);
   case algorithm::UpdateMethod::SUWA_TODO:
     return SolveByIntegerSAImpl<ModelType, updater::SuwaTodoUpdater>(
-        model, num_sweeps, rand_type, schedule, seed, min_T, max_T, log_history);
+        model, temperature_list, rand_type, seed, log_history, deadline,
+        target_energy, solution, color_list, num_threads, fast_acceptance);
   case algorithm::UpdateMethod::OPT_METROPOLIS:
     return SolveByIntegerSAImpl<ModelType, updater::OptMetropolisUpdater>(
-        model, num_sweeps, rand_type, schedule, seed, min_T, max_T, log_history);
+        model, temperature_list, rand_type, seed, log_history, deadline,
+        target_energy, solution, color_list, num_threads, fast_acceptance);
   default:
     throw std::runtime_error("Unknown update method");
   }
 }
 
+template <class ModelType>
+IntegerSAResult SolveByIntegerSA(const ModelType &model,
+                                 const std::int64_t num_sweeps,
+                                 const algorithm::UpdateMethod update_method,
+                                 const algorithm::RandomNumberEngine rand_type,
+                                 const utility::TemperatureSchedule schedule,
+                                 const std::int64_t seed, const double min_T,
+                                 const double max_T, const bool log_history,
+                                 const Deadline deadline = Deadline::max(),
+                                 const double target_energy =
+                                     -std::numeric_limits<double>::infinity(),
+                                 std::int64_t *solution = nullptr,
+                                 const bool fast_acceptance = false,
+                                 const double power_law_exponent = 2,
+                                 const double plateau_ratio = 0.5) {
+  return SolveByTemperatureList(
+      model,
+      GenerateTemperatureList(schedule, num_sweeps, min_T, max_T,
+                              power_law_exponent, plateau_ratio),
+      update_method, rand_type, seed, log_history, deadline, target_energy,
+      solution, nullptr, 1, fast_acceptance);
+}
+
+// Same as above, but the inverse temperature of each sweep is given
+// explicitly. It need not be monotonic.
+template <class ModelType>
+IntegerSAResult SolveByIntegerSA(const ModelType &model,
+                                 const std::vector<double> &beta_list,
+                                 const algorithm::UpdateMethod update_method,
+                                 const algorithm::RandomNumberEngine rand_type,
+                                 const std::int64_t seed,
+                                 const bool log_history,
+                                 const Deadline deadline = Deadline::max(),
+                                 const double target_energy =
+                                     -std::numeric_limits<double>::infinity(),
+                                 std::int64_t *solution = nullptr,
+                                 const bool fast_acceptance = false) {
+  return SolveByTemperatureList(
+      model, ConvertBetaListToTemperatureList(beta_list), update_method,
+      rand_type, seed, log_history, deadline, target_energy, solution,
+      nullptr, 1, fast_acceptance);
+}
+
+template <class ModelType>
+std::vector<IntegerSAResult> SampleByIntegerSAImpl(
+    const ModelType &model, const std::int64_t num_sweeps,
+    const algorithm::UpdateMethod update_method,
+    const algorithm::RandomNumberEngine rand_type,
+    const utility::TemperatureSchedule schedule, const std::int64_t num_reads,
+    const std::int64_t seed, const std::int32_t num_threads, const double min_T,
+    const double max_T, const bool log_history, const double time_limit,
+    const double target_energy, const std::vector<double> &beta_list,
+    std::vector<std::int64_t> *solution_buffer,
+    const bool graph_coloring = false, const bool fast_acceptance = false,
+    const double power_law_exponent = 2, const double plateau_ratio = 0.5) {
+
+  if (!(time_limit > 0)) {
+    throw std::runtime_error("time_limit must be larger than zero.");
+  }
+
+  // The schedule is shared by all the reads. A non-empty beta_list overrides
+  // num_sweeps, schedule, min_T, max_T, power_law_exponent, and plateau_ratio.
+  const std::vector<double> temperature_list =
+      beta_list.empty()
+          ? GenerateTemperatureList(schedule, num_sweeps, min_T, max_T,
+                                    power_law_exponent, plateau_ratio)
+          : ConvertBetaListToTemperatureList(beta_list);
+
+  // Reads not started by the deadline are skipped, and the running reads
+  // stop at the deadline.
+  Deadline deadline = Deadline::max();
+  if (std::isfinite(time_limit)) {
+    deadline = std::chrono::steady_clock::now() +
+               std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                   std::chrono::duration<double>(time_limit));
+  }
+
+  // If solution_buffer is given, the solution of the i-th read is written to
+  // its i-th row instead of IntegerSAResult::solution.
+  const std::int64_t num_variables = model.GetNumVariables();
+  if (solution_buffer != nullptr) {
+    solution_buffer->resize(num_reads * num_variables);
+  }
+
+  // With graph_coloring, the threads are used within each read instead of
+  // across the reads
+  std::vector<std::vector<std::int64_t>> color_list;
+  if (graph_coloring) {
+    color_list = GenerateColorList(model);
+  }
+
+  std::vector<IntegerSAResult> results(num_reads);
+  std::vector<char> is_completed_list(num_reads, false);
+
+#pragma omp parallel for schedule(guided) \
+    num_threads(graph_coloring ? 1 : num_threads)
+  for (std::int64_t i = 0; i < num_reads; ++i) {
+    if (deadline != Deadline::max() &&
+        std::chrono::steady_clock::now() >= deadline) {
+      continue;
+    }
+    std::int64_t *solution = solution_buffer != nullptr
+                                 ? solution_buffer->data() + i * num_variables
+                                 : nullptr;
+    // The seed of each read depends only on the seed and the read index
+    results[i] = SolveByTemperatureList(
+        model, temperature_list, update_method, rand_type,
+        static_cast<std::int64_t>(utility::DeriveSeed(seed, i)), log_history,
+        deadline, target_energy, solution,
+        graph_coloring ? &color_list : nullptr, num_threads, fast_acceptance);
+    is_completed_list[i] = true;
+  }
+
+  std::int64_t num_completed = 0;
+  for (std::int64_t i = 0; i < num_reads; ++i) {
+    if (is_completed_list[i]) {
+      if (num_completed != i) {
+        results[num_completed] = std::move(results[i]);
+        if (solution_buffer != nullptr) {
+          std::copy(solution_buffer->begin() + i * num_variables,
+                    solution_buffer->begin() + (i + 1) * num_variables,
+                    solution_buffer->begin() + num_completed * num_variables);
+        }
+      }
+      num_completed++;
+    }
+  }
+  results.resize(num_completed);
+  if (solution_buffer != nullptr) {
+    solution_buffer->resize(num_completed * num_variables);
+  }
+
+  return results;
+}
+
 template <class ModelType>
 std::vector<IntegerSAResult>
 SampleByIntegerSA(const ModelType &model, const std::int64_t num_sweeps,
@@ -140,18 +431,62 @@ SampleByIntegerSA(const ModelType &model, const std::int64_t num_sweeps,
                   const utility::TemperatureSchedule schedule,
                   const std::int64_t num_reads, const std::int64_t seed,
                   const std::int32_t num_threads, const double min_T,
-                  const double max_T, const bool log_history) {
+                  const double max_T, const bool log_history,
+                  const double time_limit =
+                      std::numeric_limits<double>::infinity(),
+                  const double target_energy =
+                      -std::numeric_limits<double>::infinity(),
+                  const std::vector<double> &beta_list = {},
+                  const bool graph_coloring = false,
+                  const bool fast_acceptance = false,
+                  const double power_law_exponent = 2,
+                  const double plateau_ratio = 0.5) {
+  return SampleByIntegerSAImpl(model, num_sweeps, update_method, rand_type,
+                               schedule, num_reads, seed, num_threads, min_T,
+                               max_T, log_history, time_limit, target_energy,
+                               beta_list, nullptr, graph_coloring,
+                               fast_acceptance, power_law_exponent,
+                               plateau_ratio);
+}
 
-  std::vector<IntegerSAResult> results(num_reads);
+// Same as SampleByIntegerSA, but the solutions are written directly into one
+// contiguous buffer instead of a vector per read.
+template <class ModelType>
+IntegerSASampleSet
+SampleSetByIntegerSA(const ModelType &model, const std::int64_t num_sweeps,
+                     const algorithm::UpdateMethod update_method,
+                     const algorithm::RandomNumberEngine rand_type,
+                     const utility::TemperatureSchedule schedule,
+                     const std::int64_t num_reads, const std::int64_t seed,
+                     const std::int32_t num_threads, const double min_T,
+                     const double max_T, const bool log_history,
+                     const double time_limit =
+                         std::numeric_limits<double>::infinity(),
+                     const double target_energy =
+                         -std::numeric_limits<double>::infinity(),
+                     const std::vector<double> &beta_list = {},
+                     const bool graph_coloring = false,
+                     const bool fast_acceptance = false,
+                     const double power_law_exponent = 2,
+                     const double plateau_ratio = 0.5) {
+  IntegerSASampleSet sample_set;
+  sample_set.num_variables = model.GetNumVariables();
+  auto results = SampleByIntegerSAImpl(
+      model, num_sweeps, update_method, rand_type, schedule, num_reads, seed,
+      num_threads, min_T, max_T, log_history, time_limit, target_energy,
+      beta_list, sample_set.solution_buffer.get(), graph_coloring,
+      fast_acceptance, power_law_exponent, plateau_ratio);
 
-#pragma omp parallel for schedule(guided) num_threads(num_threads)
-  for (std::int64_t i = 0; i < num_reads; ++i) {
-    results[i] =
-        SolveByIntegerSA(model, num_sweeps, update_method, rand_type, schedule,
-                         seed + i, min_T, max_T, log_history);
+  sample_set.energies.reserve(results.size());
+  sample_set.energy_history.reserve(results.size());
+  sample_set.temperature_history.reserve(results.size());
+  for (auto &result : results) {
+    sample_set.energies.push_back(result.energy);
+    sample_set.energy_history.push_back(std::move(result.energy_history));
+    sample_set.temperature_history.push_back(
+        std::move(result.temperature_history));
   }
-
-  return results;
+  return sample_set;
 }
 
 } // namespace sampler
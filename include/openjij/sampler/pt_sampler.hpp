@@ -0,0 +1,465 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "openjij/graph/all.hpp"
+#include "openjij/system/all.hpp"
+#include "openjij/updater/all.hpp"
+
+namespace openjij {
+namespace sampler {
+
+//! @brief Class for executing parallel tempering (replica exchange Monte Carlo).
+//! Each read runs a ladder of replicas at fixed inverse temperatures, which are updated in parallel,
+//! and the replicas at adjacent inverse temperatures are exchanged after every exchange interval.
+//! The ladder is adapted during the first half of the sweeps so that the exchange acceptance rates become uniform.
+//! @tparam ModelType The type of models.
+template<class ModelType>
+class PTSampler {
+   
+   //! @brief The value type.
+   using ValueType = typename ModelType::ValueType;
+      
+   //! @brief The variable type
+   using VariableType = typename ModelType::VariableType;
+   
+public:
+   //! @brief Constructor for PTSampler class.
+   //! @param model The model.
+   PTSampler(const ModelType &model): model_(model) {}
+   
+   //! @brief Set the number of sweeps of each replica.
+   //! @param num_sweeps The number of sweeps, which must be larger than zero.
+   void SetNumSweeps(const std::int32_t num_sweeps) {
+      if (num_sweeps <= 0) {
+         throw std::runtime_error("num_sweeps must be larger than zero.");
+      }
+      num_sweeps_ = num_sweeps;
+   }
+   
+   //! @brief Set the number of samples.
+   //! @param num_reads The number of samples, which must be larger than zero.
+   void SetNumReads(const std::int32_t num_reads) {
+      if (num_reads <= 0) {
+         throw std::runtime_error("num_reads must be larger than zero.");
+      }
+      num_reads_ = num_reads;
+   }
+   
+   //! @brief Set the number of replicas in the inverse temperature ladder.
+   //! @param num_replicas The number of replicas, which must be larger than one.
+   void SetNumReplicas(const std::int32_t num_replicas) {
+      if (num_replicas <= 1) {
+         throw std::runtime_error("num_replicas must be larger than one.");
+      }
+      num_replicas_ = num_replicas;
+   }
+   
+   //! @brief Set the number of sweeps between the exchange steps.
+   //! @param exchange_interval The number of sweeps, which must be larger than zero.
+   void SetExchangeInterval(const std::int32_t exchange_interval) {
+      if (exchange_interval <= 0) {
+         throw std::runtime_error("exchange_interval must be larger than zero.");
+      }
+      exchange_interval_ = exchange_interval;
+   }
+   
+   //! @brief Set the number of threads in the calculation.
+   //! @param num_threads The number of threads in the calculation, which must be larger than zero.
+   void SetNumThreads(const std::int32_t num_threads) {
+      if (num_threads <= 0) {
+         throw std::runtime_error("num_threads must be non-negative integer.");
+      }
+      num_threads_ = num_threads;
+   }
+   
+   //! @brief Set the minimum inverse temperature.
+   //! @param beta_min The minimum inverse temperature, which must be larger than zero.
+   void SetBetaMin(const ValueType beta_min) {
+      if (beta_min <= 0) {
+         throw std::runtime_error("beta_min must be positive number");
+      }
+      beta_min_ = beta_min;
+   }
+   
+   //! @brief Set the maximum inverse temperature.
+   //! @param beta_max The maximum inverse temperature, which must be larger than zero.
+   void SetBetaMax(const ValueType beta_max) {
+      if (beta_max <= 0) {
+         throw std::runtime_error("beta_max must be positive number");
+      }
+      beta_max_ = beta_max;
+   }
+   
+   //! @brief Set the minimum inverse temperature automatically.
+   void SetBetaMinAuto() {
+      beta_min_ = std::log(2.0)/model_.GetEstimatedMaxEnergyDifference();
+   }
+   
+   //! @brief Set the maximum inverse temperature automatically.
+   void SetBetaMaxAuto() {
+      beta_max_ = std::log(100.0)/model_.GetEstimatedMinEnergyDifference();
+   }
+   
+   //! @brief Set update method used in the state update.
+   //! @param update_method The update method. REJECTION_FREE is not supported,
+   //! since its state would be lost at each exchange of the replicas.
+   void SetUpdateMethod(const algorithm::UpdateMethod update_method) {
+      if (update_method == algorithm::UpdateMethod::REJECTION_FREE) {
+         throw std::runtime_error("REJECTION_FREE is not supported in PTSampler.");
+      }
+      update_method_ = update_method;
+   }
+   
+   //! @brief Set random number engine for updating initializing state.
+   //! @param random_number_engine The random number engine.
+   void SetRandomNumberEngine(const algorithm::RandomNumberEngine random_number_engine) {
+      random_number_engine_ = random_number_engine;
+   }
+   
+   //! @brief Set whether the inverse temperature ladder is adapted from the exchange acceptance rates.
+   //! @param adaptive_ladder If true, the ladder is adapted during the first half of the sweeps.
+   void SetAdaptiveLadder(const bool adaptive_ladder) {
+      adaptive_ladder_ = adaptive_ladder;
+   }
+   
+   //! @brief Set whether the fast acceptance test is used in the state update.
+   //! @param fast_acceptance If true, the exponential is evaluated by fmath and skipped for hopeless moves.
+   void SetFastAcceptance(const bool fast_acceptance) {
+      fast_acceptance_ = fast_acceptance;
+   }
+   
+   //! @brief Get the model.
+   //! @return The model.
+   const ModelType &GetModel() const {
+      return model_;
+   }
+   
+   //! @brief Get the number of sweeps of each replica.
+   //! @return The number of sweeps.
+   std::int32_t GetNumSweeps() const {
+      return num_sweeps_;
+   }
+   
+   //! @brief Get the number of reads.
+   //! @return The number of reads.
+   std::int32_t GetNumReads() const {
+      return num_reads_;
+   }
+   
+   //! @brief Get the number of replicas.
+   //! @return The number of replicas.
+   std::int32_t GetNumReplicas() const {
+      return num_replicas_;
+   }
+   
+   //! @brief Get the number of sweeps between the exchange steps.
+   //! @return The number of sweeps.
+   std::int32_t GetExchangeInterval() const {
+      return exchange_interval_;
+   }
+   
+   //! @brief Get the number of threads.
+   //! @return The number of threads.
+   std::int32_t GetNumThreads() const {
+      return num_threads_;
+   }
+   
+   //! @brief Get the minimum inverse temperature.
+   //! @return The minimum inverse temperature.
+   ValueType GetBetaMin() const {
+      return beta_min_;
+   }
+   
+   //! @brief Get the maximum inverse temperature.
+   //! @return The maximum inverse temperature.
+   ValueType GetBetaMax() const {
+      return beta_max_;
+   }
+   
+   //! @brief Get the update method used in the state update.
+   //! @return The update method used in the state update.
+   algorithm::UpdateMethod GetUpdateMethod() const {
+      return update_method_;
+   }
+   
+   //! @brief Get the random number engine for updating and initializing state.
+   //! @return The random number engine for updating and initializing state.
+   algorithm::RandomNumberEngine GetRandomNumberEngine() const {
+      return random_number_engine_;
+   }
+   
+   //! @brief Get whether the inverse temperature ladder is adapted.
+   //! @return True if the ladder is adapted.
+   bool GetAdaptiveLadder() const {
+      return adaptive_ladder_;
+   }
+   
+   //! @brief Get whether the fast acceptance test is used in the state update.
+   //! @return True if the fast acceptance test is used.
+   bool GetFastAcceptance() const {
+      return fast_acceptance_;
+   }
+   
+   //! @brief Get the seed to be used in the calculation.
+   //! @return The seed.
+   std::uint64_t GetSeed() const {
+      return seed_;
+   }
+   
+   const std::vector<typename ModelType::IndexType> &GetIndexList() const {
+      return model_.GetIndexList();
+   }
+   
+   //! @brief Get the inverse temperature ladder used in the last read.
+   //! @return The inverse temperatures in ascending order.
+   const std::vector<ValueType> &GetBetaList() const {
+      return beta_list_;
+   }
+   
+   //! @brief Get the exchange acceptance rates between adjacent inverse temperatures in the last read,
+   //! which are measured after the ladder is fixed.
+   //! @return The acceptance rates, whose size is the number of replicas minus one.
+   const std::vector<double> &GetExchangeAcceptanceRates() const {
+      return exchange_acceptance_rates_;
+   }
+   
+   //! @brief Get the samples.
+   //! Each sample is the lowest energy state visited by any replica at the exchange steps.
+   //! @return The samples.
+   const std::vector<std::vector<VariableType>> &GetSamples() const {
+      return samples_;
+   }
+   
+   std::vector<ValueType> CalculateEnergies() const {
+      if (samples_.size() == 0) {
+         throw std::runtime_error("The sample size is zero. It seems that sampling has not been carried out.");
+      }
+      std::vector<ValueType> energies(num_reads_);
+      for (std::int32_t i = 0; i < num_reads_; ++i) {
+         energies[i] = model_.CalculateEnergy(samples_[i]);
+      }
+      return energies;
+   }
+   
+   //! @brief Execute sampling.
+   //! Seed to be used in the calculation will be set automatically.
+   void Sample() {
+      Sample(std::random_device()());
+   }
+   
+   //! @brief Execute sampling.
+   //! @param seed The seed to be used in the calculation.
+   void Sample(const std::uint64_t seed) {
+      if (beta_min_ > beta_max_) {
+         throw std::runtime_error("beta_min must not be larger than beta_max.");
+      }
+      seed_ = seed;
+      
+      samples_.clear();
+      samples_.shrink_to_fit();
+      samples_.resize(num_reads_);
+      
+      algorithm::DispatchErasedRandomNumberEngine(random_number_engine_, [this](auto tag) {
+         using RandType = typename decltype(tag)::type;
+         TemplateSampler<system::SASystem<ModelType, RandType>, RandType>();
+      });
+   }
+   
+private:
+   //! @brief The model.
+   const ModelType model_;
+   
+   //! @brief The number of sweeps of each replica.
+   std::int32_t num_sweeps_ = 1000;
+   
+   //! @brief The number of reads (samples).
+   std::int32_t num_reads_ = 1;
+   
+   //! @brief The number of replicas in the inverse temperature ladder.
+   std::int32_t num_replicas_ = 16;
+   
+   //! @brief The number of sweeps between the exchange steps.
+   std::int32_t exchange_interval_ = 1;
+   
+   //! @brief The number of threads in the calculation.
+   std::int32_t num_threads_ = 1;
+   
+   //! @brief The minimum inverse temperature.
+   ValueType beta_min_ = 1;
+   
+   //! @brief The maximum inverse temperature.
+   ValueType beta_max_ = 1;
+   
+   //! @brief The update method used in the state update.
+   algorithm::UpdateMethod update_method_ = algorithm::UpdateMethod::METROPOLIS;
+   
+   //! @brief Random number engine for updating and initializing state.
+   algorithm::RandomNumberEngine random_number_engine_ = algorithm::RandomNumberEngine::XORSHIFT;
+   
+   //! @brief Whether the inverse temperature ladder is adapted.
+   bool adaptive_ladder_ = true;
+   
+   //! @brief Whether the fast acceptance test is used in the state update.
+   bool fast_acceptance_ = false;
+   
+   //! @brief The seed to be used in the calculation.
+   std::uint64_t seed_ = std::random_device()();
+   
+   //! @brief The inverse temperature ladder used in the last read.
+   std::vector<ValueType> beta_list_;
+   
+   //! @brief The exchange acceptance rates in the last read.
+   std::vector<double> exchange_acceptance_rates_;
+   
+   //! @brief The samples.
+   std::vector<std::vector<VariableType>> samples_;
+   
+   //! @brief The number of exchange attempts per adjacent pair between the ladder adaptations.
+   constexpr static std::int32_t adaptation_window = 32;
+   
+   //! @brief Move the inverse temperatures so that the intervals with low exchange acceptance rates shrink.
+   //! The intervals are measured in the logarithm of the inverse temperature and the both ends are kept fixed.
+   //! @param beta_list The inverse temperature ladder.
+   //! @param acceptance_rates The exchange acceptance rates between adjacent inverse temperatures.
+   static void AdaptBetaList(std::vector<ValueType> *beta_list, const std::vector<double> &acceptance_rates) {
+      const std::int32_t num_intervals = static_cast<std::int32_t>(acceptance_rates.size());
+      const double log_beta_min = std::log(beta_list->front());
+      const double log_width = std::log(beta_list->back()) - log_beta_min;
+      if (!(log_width > 0)) {
+         return;
+      }
+      // The square root damps the oscillation of the ladder caused by the noisy rates,
+      // and a small offset keeps the intervals with no accepted exchanges from collapsing at once
+      std::vector<double> weight(num_intervals);
+      for (std::int32_t k = 0; k < num_intervals; ++k) {
+         weight[k] = (std::log((*beta_list)[k + 1]) - std::log((*beta_list)[k]))*std::sqrt(acceptance_rates[k] + 0.05);
+      }
+      const double total_weight = std::accumulate(weight.begin(), weight.end(), 0.0);
+      double log_beta = log_beta_min;
+      for (std::int32_t k = 0; k < num_intervals - 1; ++k) {
+         log_beta += log_width*weight[k]/total_weight;
+         (*beta_list)[k + 1] = static_cast<ValueType>(std::exp(log_beta));
+      }
+   }
+   
+   template<class SystemType, class RandType>
+   void TemplateSampler() {
+      auto read_random_number_engine = algorithm::MakeRandomNumberEngine<RandType>(random_number_engine_, seed_);
+      
+      for (std::int32_t read = 0; read < num_reads_; ++read) {
+         auto random_number_engine = algorithm::MakeRandomNumberEngine<RandType>(random_number_engine_, read_random_number_engine());
+         std::uniform_real_distribution<double> dist_real(0, 1);
+         
+         // Replicas and their own random number engines, which move along the ladder together
+         std::vector<SystemType> system_list;
+         std::vector<RandType> system_random_number_engine_list;
+         system_list.reserve(num_replicas_);
+         system_random_number_engine_list.reserve(num_replicas_);
+         for (std::int32_t j = 0; j < num_replicas_; ++j) {
+            auto spin_random_number_engine = algorithm::MakeRandomNumberEngine<RandType>(random_number_engine_, random_number_engine());
+            system_list.emplace_back(model_, spin_random_number_engine);
+            system_random_number_engine_list.push_back(algorithm::MakeRandomNumberEngine<RandType>(random_number_engine_, random_number_engine()));
+         }
+         
+         // system_index[k] is the replica at the k-th inverse temperature
+         std::vector<std::int32_t> system_index(num_replicas_);
+         std::iota(system_index.begin(), system_index.end(), 0);
+         
+         std::vector<ValueType> beta_list = utility::GenerateBetaList(utility::TemperatureSchedule::GEOMETRIC, beta_min_, beta_max_, num_replicas_);
+         
+         // sweep_beta_list[k] is passed to the updater at the k-th inverse temperature, and is refilled only when the ladder is adapted
+         std::vector<std::vector<ValueType>> sweep_beta_list(num_replicas_);
+         for (std::int32_t k = 0; k < num_replicas_; ++k) {
+            sweep_beta_list[k].assign(exchange_interval_, beta_list[k]);
+         }
+         std::vector<std::int32_t> num_accepted(num_replicas_ - 1, 0);
+         std::vector<std::int32_t> num_attempted(num_replicas_ - 1, 0);
+         
+         ValueType min_energy = std::numeric_limits<ValueType>::max();
+         std::vector<VariableType> min_sample;
+         
+         const std::int32_t num_rounds = (num_sweeps_ + exchange_interval_ - 1)/exchange_interval_;
+         const std::int32_t num_adaptive_rounds = adaptive_ladder_ ? num_rounds/2 : 0;
+         
+         for (std::int32_t round = 0; round < num_rounds; ++round) {
+            const std::int32_t num_sweeps = std::min(exchange_interval_, num_sweeps_ - round*exchange_interval_);
+            
+#pragma omp parallel for schedule(static) num_threads(num_threads_)
+            for (std::int32_t k = 0; k < num_replicas_; ++k) {
+               const std::int32_t j = system_index[k];
+               updater::SingleFlipUpdater<SystemType, RandType>(&system_list[j], num_sweeps, sweep_beta_list[k], system_random_number_engine_list[j], update_method_, fast_acceptance_);
+            }
+            
+            for (std::int32_t k = 0; k < num_replicas_; ++k) {
+               const auto &system = system_list[system_index[k]];
+               if (system.GetEnergy() < min_energy) {
+                  min_energy = system.GetEnergy();
+                  min_sample = system.ExtractSample();
+               }
+            }
+            
+            // Exchange the replicas at even and odd pairs alternately
+            for (std::int32_t k = round % 2; k < num_replicas_ - 1; k += 2) {
+               const ValueType delta = (beta_list[k] - beta_list[k + 1])*(system_list[system_index[k]].GetEnergy() - system_list[system_index[k + 1]].GetEnergy());
+               num_attempted[k]++;
+               if (delta >= 0 || std::exp(delta) > dist_real(random_number_engine)) {
+                  std::swap(system_index[k], system_index[k + 1]);
+                  num_accepted[k]++;
+               }
+            }
+            
+            // Adapt the ladder and reset the statistics, which are finally measured on the fixed ladder
+            const bool adapt = round < num_adaptive_rounds && (round + 1) % (2*adaptation_window) == 0;
+            if (adapt || round + 1 == num_adaptive_rounds) {
+               if (adapt) {
+                  std::vector<double> acceptance_rates(num_replicas_ - 1);
+                  for (std::int32_t k = 0; k < num_replicas_ - 1; ++k) {
+                     acceptance_rates[k] = static_cast<double>(num_accepted[k])/std::max(num_attempted[k], 1);
+                  }
+                  AdaptBetaList(&beta_list, acceptance_rates);
+                  for (std::int32_t k = 0; k < num_replicas_; ++k) {
+                     std::fill(sweep_beta_list[k].begin(), sweep_beta_list[k].end(), beta_list[k]);
+                  }
+               }
+               std::fill(num_accepted.begin(), num_accepted.end(), 0);
+               std::fill(num_attempted.begin(), num_attempted.end(), 0);
+            }
+         }
+         
+         samples_[read] = min_sample;
+         beta_list_ = beta_list;
+         exchange_acceptance_rates_.resize(num_replicas_ - 1);
+         for (std::int32_t k = 0; k < num_replicas_ - 1; ++k) {
+            exchange_acceptance_rates_[k] = static_cast<double>(num_accepted[k])/std::max(num_attempted[k], 1);
+         }
+      }
+   }
+   
+};
+
+template<class ModelType>
+auto make_pt_sampler(const ModelType &model) {
+   return PTSampler<ModelType>{model};
+};
+
+
+} //sampler
+} //openjij
@@ -17,6 +17,15 @@
 #include "openjij/graph/all.hpp"
 #include "openjij/updater/all.hpp"
 #include "openjij/system/all.hpp"
+#include "openjij/utility/packed_sample_store.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
 
 namespace openjij {
 namespace sampler {
@@ -109,6 +118,111 @@ public:
    void SetTemperatureSchedule(const utility::TemperatureSchedule schedule) {
       schedule_ = schedule;
    }
+   
+   //! @brief Set the exponent of the power-law schedule.
+   //! @param exponent The exponent, which must be larger than zero.
+   void SetPowerLawExponent(const ValueType exponent) {
+      if (!(exponent > 0)) {
+         throw std::runtime_error("exponent must be larger than zero.");
+      }
+      power_law_exponent_ = exponent;
+   }
+   
+   //! @brief Set the ratio of the sweeps at beta_max in the exponential-plateau schedule.
+   //! @param plateau_ratio The ratio, which must be in [0, 1).
+   void SetPlateauRatio(const ValueType plateau_ratio) {
+      if (!(0 <= plateau_ratio && plateau_ratio < 1)) {
+         throw std::runtime_error("plateau_ratio must be in [0, 1).");
+      }
+      plateau_ratio_ = plateau_ratio;
+   }
+   
+   //! @brief Set whether up to 64 reads are packed into one replica-packed system.
+   //! @param replica_packing If true, the reads are bit-packed and updated at once.
+   void SetReplicaPacking(const bool replica_packing) {
+      replica_packing_ = replica_packing;
+   }
+   
+   //! @brief Set whether the variables of each color of the interaction graph are updated at the same time.
+   //! The reads are then run one by one, and num_threads threads update the variables within a read,
+   //! which suits very large sparse models with few reads. Only METROPOLIS and HEAT_BATH are supported.
+   //! @param graph_coloring If true, the interaction graph is colored and the variables of each color are updated in parallel.
+   void SetGraphColoring(const bool graph_coloring) {
+      graph_coloring_ = graph_coloring;
+   }
+   
+   //! @brief Set whether the fast acceptance test is used in the state update.
+   //! @param fast_acceptance If true, the exponential is evaluated by fmath and skipped for hopeless moves.
+   void SetFastAcceptance(const bool fast_acceptance) {
+      fast_acceptance_ = fast_acceptance;
+   }
+   
+   //! @brief Set whether identical samples are merged.
+   //! @param aggregate_samples If true, the reads are bit-packed into a sample store as they finish and identical ones are merged,
+   //! so that the samples are the unique ones with their numbers of occurrences.
+   void SetAggregateSamples(const bool aggregate_samples) {
+      aggregate_samples_ = aggregate_samples;
+   }
+   
+   //! @brief Set the initial states of the reads, which are otherwise drawn at random.
+   //! The i-th read starts from the (i % the number of initial states)-th state, so that a single state warm-starts all the reads.
+   //! @param initial_states The initial states in the order of the index list. An empty list restores the random initial states.
+   void SetInitialStates(const std::vector<std::vector<VariableType>> &initial_states) {
+      const VariableType lower_value = is_ising ? -1 : 0;
+      for (const auto &state: initial_states) {
+         if (state.size() != static_cast<std::size_t>(model_.GetSystemSize())) {
+            throw std::runtime_error("The size of initial variables is not equal to the system size.");
+         }
+         for (const auto v: state) {
+            if (!(v == lower_value || v == 1)) {
+               throw std::runtime_error(is_ising ? "The initial variables must be -1 or 1." : "The initial variables must be 0 or 1.");
+            }
+         }
+      }
+      initial_states_ = initial_states;
+   }
+   
+   //! @brief Set the inverse temperature of each sweep, which overrides beta_min, beta_max, num_sweeps, and the temperature schedule.
+   //! The list need not be monotonic; for example, reverse annealing starts from a large value, decreases it, and increases it again.
+   //! @param beta_list The inverse temperatures, which must be non-negative. An empty list restores the generated schedule.
+   void SetBetaList(const std::vector<ValueType> &beta_list) {
+      for (const auto beta: beta_list) {
+         if (!(beta >= 0)) {
+            throw std::runtime_error("beta must be non-negative number.");
+         }
+      }
+      beta_list_ = beta_list;
+   }
+   
+   //! @brief Set the inverse temperatures and the number of sweeps at each of them, which override beta_min, beta_max, num_sweeps, and the temperature schedule.
+   //! @param beta_list The inverse temperatures, which must be non-negative.
+   //! @param num_repeats_list The number of sweeps at each inverse temperature, each of which must be larger than zero.
+   void SetBetaList(const std::vector<ValueType> &beta_list, const std::vector<std::int32_t> &num_repeats_list) {
+      SetBetaList(utility::RepeatBetaList(beta_list, num_repeats_list));
+   }
+   
+   //! @brief Set whether the energies tracked during the sampling are checked against a full evaluation for debugging.
+   //! @param energy_check If true, the sampling throws std::runtime_error when a tracked energy differs from the evaluated one.
+   void SetEnergyCheck(const bool energy_check) {
+      energy_check_ = energy_check;
+   }
+   
+   //! @brief Set the wall-clock time limit of the sampling.
+   //! Reads not started by the deadline are skipped, and the running reads stop at the deadline.
+   //! @param time_limit The time limit in seconds, which must be larger than zero. Infinity means no limit.
+   void SetTimeLimit(const double time_limit) {
+      if (!(time_limit > 0)) {
+         throw std::runtime_error("time_limit must be larger than zero.");
+      }
+      time_limit_ = time_limit;
+   }
+   
+   //! @brief Set the target energy. A read stops as soon as its energy reaches the target energy.
+   //! This is not checked with replica packing, since the packed systems do not track the energies.
+   //! @param target_energy The target energy. Negative infinity means no target.
+   void SetTargetEnergy(const ValueType target_energy) {
+      target_energy_ = target_energy;
+   }
          
    //! @brief Get the model.
    //! @return The model.
@@ -164,6 +278,72 @@ public:
       return schedule_;
    }
    
+   //! @brief Get the exponent of the power-law schedule.
+   //! @return The exponent.
+   ValueType GetPowerLawExponent() const {
+      return power_law_exponent_;
+   }
+   
+   //! @brief Get the ratio of the sweeps at beta_max in the exponential-plateau schedule.
+   //! @return The ratio.
+   ValueType GetPlateauRatio() const {
+      return plateau_ratio_;
+   }
+   
+   //! @brief Get whether the reads are packed into replica-packed systems.
+   //! @return True if the reads are packed.
+   bool GetReplicaPacking() const {
+      return replica_packing_;
+   }
+   
+   //! @brief Get whether the variables of each color of the interaction graph are updated at the same time.
+   //! @return True if the graph coloring is used.
+   bool GetGraphColoring() const {
+      return graph_coloring_;
+   }
+   
+   //! @brief Get whether the fast acceptance test is used in the state update.
+   //! @return True if the fast acceptance test is used.
+   bool GetFastAcceptance() const {
+      return fast_acceptance_;
+   }
+   
+   //! @brief Get whether identical samples are merged.
+   //! @return True if identical samples are merged.
+   bool GetAggregateSamples() const {
+      return aggregate_samples_;
+   }
+   
+   //! @brief Get the initial states of the reads.
+   //! @return The initial states, which are empty if the reads start from random states.
+   const std::vector<std::vector<VariableType>> &GetInitialStates() const {
+      return initial_states_;
+   }
+   
+   //! @brief Get the inverse temperature of each sweep set by SetBetaList.
+   //! @return The inverse temperatures, which are empty if the schedule is generated.
+   const std::vector<ValueType> &GetBetaList() const {
+      return beta_list_;
+   }
+   
+   //! @brief Get whether the tracked energies are checked against a full evaluation.
+   //! @return True if the tracked energies are checked.
+   bool GetEnergyCheck() const {
+      return energy_check_;
+   }
+   
+   //! @brief Get the wall-clock time limit of the sampling.
+   //! @return The time limit in seconds.
+   double GetTimeLimit() const {
+      return time_limit_;
+   }
+   
+   //! @brief Get the target energy.
+   //! @return The target energy.
+   ValueType GetTargetEnergy() const {
+      return target_energy_;
+   }
+   
    //! @brief Get the seed to be used in the calculation.
    //! @return The seed.
    std::uint64_t GetSeed() const {
@@ -174,29 +354,67 @@ public:
       return model_.GetIndexList();
    }
    
-   //! @brief Get the samples.
+   //! @brief Get the number of samples, which is the number of the reads completed within the time limit,
+   //! or the number of the unique ones if the samples are aggregated.
+   //! @return The number of samples.
+   std::int32_t GetNumSamples() const {
+      return num_samples_;
+   }
+   
+   //! @brief Get the samples. Only the reads completed within the time limit are included.
+   //! This copies the sample buffer into a vector per sample; use GetSampleBuffer to avoid the copy.
    //! @return The samples.
-   const std::vector<std::vector<VariableType>> &GetSamples() const {
-      return samples_;
+   std::vector<std::vector<VariableType>> GetSamples() const {
+      const std::size_t system_size = model_.GetSystemSize();
+      std::vector<std::vector<VariableType>> samples(num_samples_);
+      for (std::int32_t i = 0; i < num_samples_; ++i) {
+         const auto begin = sample_buffer_->begin() + i*system_size;
+         samples[i].assign(begin, begin + system_size);
+      }
+      return samples;
    }
    
-   std::vector<ValueType> CalculateEnergies() const {
-      if (samples_.size() == 0) {
-         throw std::runtime_error("The sample size is zero. It seems that sampling has not been carried out.");
+   //! @brief Get the samples as one row-major buffer of (the number of samples) x (the system size).
+   //! Each sampling allocates a new buffer, so the returned buffer stays valid and unchanged after the next sampling.
+   //! @return The sample buffer.
+   std::shared_ptr<const std::vector<VariableType>> GetSampleBuffer() const {
+      if (!sample_buffer_) {
+         throw std::runtime_error("Sampling has not been carried out.");
       }
-      std::vector<ValueType> energies(num_reads_);
-      
-      try {
-#pragma omp parallel for schedule(guided) num_threads(num_threads_)
-         for (std::int32_t i = 0; i < num_reads_; ++i) {
-            energies[i] = model_.CalculateEnergy(samples_[i]);
-         }
+      return sample_buffer_;
+   }
+   
+   //! @brief Get the number of occurrences of each sample, which is one for all the samples unless they are aggregated.
+   //! @return The numbers of occurrences.
+   std::vector<std::int32_t> GetNumOccurrences() const {
+      if (!sample_store_) {
+         return std::vector<std::int32_t>(num_samples_, 1);
       }
-      catch (const std::exception &e) {
-         std::cerr << e.what() << std::endl;
+      std::vector<std::int32_t> num_occurrences;
+      num_occurrences.reserve(num_samples_);
+      for (const auto row: sample_store_->unique_row_list()) {
+         num_occurrences.push_back(sample_store_->num_occurrences(row));
       }
-      
-      return energies;
+      return num_occurrences;
+   }
+   
+   //! @brief Get the bit-packed sample store, which is available only if the samples are aggregated.
+   //! @return The sample store.
+   std::shared_ptr<const utility::PackedSampleStore<VariableType, ValueType>> GetSampleStore() const {
+      if (!sample_store_) {
+         throw std::runtime_error("The samples are not aggregated.");
+      }
+      return sample_store_;
+   }
+   
+   //! @brief Get the energies of the samples.
+   //! These are the energies tracked by the systems during the sampling, so no full evaluation is carried out.
+   //! @return The energies.
+   std::vector<ValueType> CalculateEnergies() const {
+      if (!sample_buffer_) {
+         throw std::runtime_error("The sample size is zero. It seems that sampling has not been carried out.");
+      }
+      return energy_list_;
    }
    
    //! @brief Execute sampling.
@@ -208,25 +426,75 @@ public:
    //! @brief Execute sampling.
    //! @param seed The seed to be used in the calculation.
    void Sample(const std::uint64_t seed) {
+      if (graph_coloring_ && replica_packing_) {
+         throw std::runtime_error("graph_coloring cannot be used with replica_packing.");
+      }
+      if (graph_coloring_ && update_method_ != algorithm::UpdateMethod::METROPOLIS && update_method_ != algorithm::UpdateMethod::HEAT_BATH) {
+         throw std::runtime_error("graph_coloring supports only METROPOLIS and HEAT_BATH.");
+      }
       seed_ = seed;
       
-      samples_.clear();
-      samples_.shrink_to_fit();
-      samples_.resize(num_reads_);
-            
-      if (random_number_engine_ == algorithm::RandomNumberEngine::XORSHIFT) {
-         TemplateSampler<system::SASystem<ModelType, utility::Xorshift>, utility::Xorshift>();
+      if (std::isfinite(time_limit_)) {
+         deadline_ = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(time_limit_));
       }
-      else if (random_number_engine_ == algorithm::RandomNumberEngine::MT) {
-         TemplateSampler<system::SASystem<ModelType, std::mt19937>, std::mt19937>();
+      
+      // A new buffer is allocated so that the buffers handed out before are kept intact
+      const std::size_t system_size = model_.GetSystemSize();
+      if (aggregate_samples_) {
+         const VariableType lower_value = is_ising ? -1 : 0;
+         sample_store_ = std::make_shared<utility::PackedSampleStore<VariableType, ValueType>>(system_size, num_reads_, lower_value, 1);
+         sample_buffer_ = std::make_shared<std::vector<VariableType>>();
       }
-      else if (random_number_engine_ == algorithm::RandomNumberEngine::MT_64) {
-         TemplateSampler<system::SASystem<ModelType, std::mt19937_64>, std::mt19937_64>();
+      else {
+         sample_store_ = nullptr;
+         sample_buffer_ = std::make_shared<std::vector<VariableType>>(num_reads_*system_size);
+      }
+      is_completed_list_.assign(num_reads_, false);
+      energy_list_.assign(num_reads_, 0);
+            
+      algorithm::DispatchRandomNumberEngine(random_number_engine_, [this](auto tag) {
+         using RandType = typename decltype(tag)::type;
+         if (replica_packing_) {
+            TemplateReplicaPackedSampler<system::ReplicaPackedSASystem<ModelType, RandType>, RandType>();
+         }
+         else {
+            TemplateSampler<system::SASystem<ModelType, RandType>, RandType>();
+         }
+      });
+      
+      if (sample_store_) {
+         // Unpack the unique samples
+         const auto row_list = sample_store_->unique_row_list();
+         sample_buffer_->resize(row_list.size()*system_size);
+         energy_list_.resize(row_list.size());
+         for (std::size_t i = 0; i < row_list.size(); ++i) {
+            sample_store_->unpack(row_list[i], sample_buffer_->data() + i*system_size);
+            energy_list_[i] = sample_store_->energy(row_list[i]);
+         }
+         num_samples_ = static_cast<std::int32_t>(row_list.size());
       }
       else {
-         throw std::runtime_error("Unknown RandomNumberEngine");
+         // Drop the reads skipped by the time limit
+         auto &sample_buffer = *sample_buffer_;
+         std::int32_t num_completed = 0;
+         for (std::int32_t i = 0; i < num_reads_; ++i) {
+            if (is_completed_list_[i]) {
+               if (num_completed != i) {
+                  std::copy(sample_buffer.begin() + i*system_size, sample_buffer.begin() + (i + 1)*system_size,
+                            sample_buffer.begin() + num_completed*system_size);
+                  energy_list_[num_completed] = energy_list_[i];
+               }
+               num_completed++;
+            }
+         }
+         sample_buffer.resize(num_completed*system_size);
+         energy_list_.resize(num_completed);
+         num_samples_ = num_completed;
+      }
+      
+      if (energy_check_) {
+         CheckEnergies();
       }
-
    }
    
 private:
@@ -257,18 +525,125 @@ private:
    //! @brief Cooling schedule.
    utility::TemperatureSchedule schedule_ = utility::TemperatureSchedule::GEOMETRIC;
    
+   //! @brief The exponent of the power-law schedule.
+   ValueType power_law_exponent_ = 2;
+   
+   //! @brief The ratio of the sweeps at beta_max in the exponential-plateau schedule.
+   ValueType plateau_ratio_ = 0.5;
+   
+   //! @brief Whether the reads are packed into replica-packed systems.
+   bool replica_packing_ = false;
+   
+   //! @brief Whether the variables of each color of the interaction graph are updated at the same time.
+   bool graph_coloring_ = false;
+   
+   //! @brief The variables of each color of the interaction graph, which is computed once for the model.
+   std::vector<std::vector<std::int32_t>> color_list_;
+   
+   //! @brief Whether the fast acceptance test is used in the state update.
+   bool fast_acceptance_ = false;
+   
+   //! @brief The wall-clock time limit in seconds.
+   double time_limit_ = std::numeric_limits<double>::infinity();
+   
+   //! @brief The target energy.
+   ValueType target_energy_ = -std::numeric_limits<ValueType>::infinity();
+   
+   //! @brief The deadline of the current sampling.
+   std::chrono::steady_clock::time_point deadline_;
+   
    //! @brief The seed to be used in the calculation.
    std::uint64_t seed_ = std::random_device()();
    
-   //! @brief The samples.
-   std::vector<std::vector<VariableType>> samples_;
+   //! @brief The samples stored in a row-major buffer of (the number of samples) x (the system size).
+   std::shared_ptr<std::vector<VariableType>> sample_buffer_;
+   
+   //! @brief The number of samples.
+   std::int32_t num_samples_ = 0;
+   
+   //! @brief Whether identical samples are merged.
+   bool aggregate_samples_ = false;
+   
+   //! @brief The bit-packed samples, which are used if the samples are aggregated.
+   std::shared_ptr<utility::PackedSampleStore<VariableType, ValueType>> sample_store_;
+   
+   //! @brief The initial states of the reads.
+   std::vector<std::vector<VariableType>> initial_states_;
+   
+   //! @brief The inverse temperature of each sweep, which is generated from the schedule if empty.
+   std::vector<ValueType> beta_list_;
+   
+   //! @brief The energies of the samples.
+   std::vector<ValueType> energy_list_;
+   
+   //! @brief Whether the tracked energies are checked against a full evaluation.
+   bool energy_check_ = false;
+   
+   //! @brief Whether the model is an Ising model, whose variables are -1 or +1.
+   static constexpr bool is_ising = std::is_same<ModelType, graph::IsingPolynomialModel<ValueType>>::value;
+   
+   //! @brief Store the sample of a read.
+   //! @param read The index of the read.
+   //! @param sample The sample.
+   //! @param calculate_energy Function returning the energy of the sample, which is called only if the energy is stored,
+   //! that is, unless the samples are aggregated and the sample has already been stored.
+   template<class EnergyFunction>
+   void StoreSample(const std::int32_t read, const std::vector<VariableType> &sample, const EnergyFunction &calculate_energy) {
+      if (sample_store_) {
+         const auto [row, inserted] = sample_store_->insert(sample);
+         if (inserted) {
+            sample_store_->set_energy(row, calculate_energy());
+         }
+      }
+      else {
+         std::copy(sample.begin(), sample.end(), sample_buffer_->begin() + static_cast<std::size_t>(read)*sample.size());
+         energy_list_[read] = calculate_energy();
+      }
+      is_completed_list_[read] = true;
+   }
+   
+   //! @brief Check the energies of the samples against a full evaluation.
+   void CheckEnergies() const {
+      const std::size_t system_size = model_.GetSystemSize();
+      const ValueType tolerance = std::sqrt(std::numeric_limits<ValueType>::epsilon());
+      for (std::int32_t i = 0; i < num_samples_; ++i) {
+         const auto begin = sample_buffer_->begin() + i*system_size;
+         const ValueType energy = model_.CalculateEnergy(std::vector<VariableType>(begin, begin + system_size));
+         if (std::abs(energy - energy_list_[i]) > tolerance*std::max<ValueType>(1, std::abs(energy))) {
+            throw std::runtime_error("The tracked energy differs from the evaluated one.");
+         }
+      }
+   }
+   
+   //! @brief Whether each read has been carried out, which is false for the reads skipped by the time limit.
+   std::vector<char> is_completed_list_;
+   
+   std::vector<ValueType> GenerateBetaList() const {
+      if (!beta_list_.empty()) {
+         return beta_list_;
+      }
+      return utility::GenerateBetaList(schedule_, beta_min_, beta_max_, num_sweeps_, power_law_exponent_, plateau_ratio_);
+   }
+   
+   bool IsTimeUp() const {
+      return std::isfinite(time_limit_) && std::chrono::steady_clock::now() >= deadline_;
+   }
    
    template<typename RandType>
    std::vector<std::pair<typename RandType::result_type, typename RandType::result_type>>
    GenerateSeedPairList(const typename RandType::result_type seed, const std::int32_t num_reads) const {
-      RandType random_number_engine(seed);
       std::vector<std::pair<typename RandType::result_type, typename RandType::result_type>> seed_pair_list(num_reads);
       
+      if constexpr (std::is_same<RandType, utility::Philox4x32>::value) {
+         // Keys of the streams are derived from the seed and the read alone
+         for (std::int32_t i = 0; i < num_reads; ++i) {
+            seed_pair_list[i].first = utility::DeriveSeed(seed, 2*static_cast<std::uint64_t>(i));
+            seed_pair_list[i].second = utility::DeriveSeed(seed, 2*static_cast<std::uint64_t>(i) + 1);
+         }
+         return seed_pair_list;
+      }
+      
+      RandType random_number_engine(seed);
       for (std::int32_t i = 0; i < num_reads; ++i) {
          seed_pair_list[i].first = random_number_engine();
          seed_pair_list[i].second = random_number_engine();
@@ -280,13 +655,71 @@ private:
    template<class SystemType, class RandType>
    void TemplateSampler() {
       const auto seed_pair_list = GenerateSeedPairList<RandType>(static_cast<typename RandType::result_type>(seed_), num_reads_);
-      std::vector<ValueType> beta_list = utility::GenerateBetaList(schedule_, beta_min_, beta_max_, num_sweeps_);
+      const std::vector<ValueType> beta_list = GenerateBetaList();
+      const std::int32_t num_sweeps = static_cast<std::int32_t>(beta_list.size());
       
-#pragma omp parallel for schedule(guided) num_threads(num_threads_)
+      const bool has_target = target_energy_ > -std::numeric_limits<ValueType>::infinity();
+      
+      // With the graph coloring, the threads are used within a read instead of across the reads
+      if (graph_coloring_ && color_list_.empty() && num_reads_ > 0) {
+         color_list_ = utility::GreedyColoring(updater::GenerateNeighborList(SystemType{model_, seed_pair_list[0].first}));
+      }
+      
+#pragma omp parallel for schedule(guided) num_threads(graph_coloring_ ? 1 : num_threads_)
       for (std::int32_t i = 0; i < num_reads_; ++i) {
+         if (IsTimeUp()) {
+            continue;
+         }
          auto system = SystemType{model_, seed_pair_list[i].first};
-         updater::SingleFlipUpdater<SystemType, RandType>(&system, num_sweeps_, beta_list, seed_pair_list[i].second, update_method_);
-         samples_[i] = system.ExtractSample();
+         if (!initial_states_.empty()) {
+            system.SetSample(initial_states_[i % initial_states_.size()]);
+         }
+         std::function<bool()> is_finished = nullptr;
+         if (has_target || std::isfinite(time_limit_)) {
+            is_finished = [this, &system]() {
+               return system.GetEnergy() <= target_energy_ || IsTimeUp();
+            };
+         }
+         if (graph_coloring_) {
+            updater::ColoredSingleFlipUpdater<SystemType, RandType>(&system, num_sweeps, beta_list, seed_pair_list[i].second, update_method_, fast_acceptance_, color_list_, num_threads_, is_finished);
+         }
+         else {
+            updater::SingleFlipUpdater<SystemType, RandType>(&system, num_sweeps, beta_list, seed_pair_list[i].second, update_method_, fast_acceptance_, is_finished);
+         }
+         StoreSample(i, system.ExtractSample(), [&system]() { return system.GetEnergy(); });
+      }
+   }
+   
+   template<class SystemType, class RandType>
+   void TemplateReplicaPackedSampler() {
+      const std::int32_t num_replicas = SystemType::max_num_replicas;
+      const std::int32_t num_packs = (num_reads_ + num_replicas - 1)/num_replicas;
+      const auto seed_pair_list = GenerateSeedPairList<RandType>(static_cast<typename RandType::result_type>(seed_), num_packs);
+      const std::vector<ValueType> beta_list = GenerateBetaList();
+      const std::int32_t num_sweeps = static_cast<std::int32_t>(beta_list.size());
+      
+#pragma omp parallel for schedule(guided) num_threads(num_threads_)
+      for (std::int32_t i = 0; i < num_packs; ++i) {
+         if (IsTimeUp()) {
+            continue;
+         }
+         const std::int32_t offset = i*num_replicas;
+         auto system = SystemType{model_, std::min(num_replicas, num_reads_ - offset), seed_pair_list[i].first};
+         if (!initial_states_.empty()) {
+            for (std::int32_t r = 0; r < system.GetNumReplicas(); ++r) {
+               system.SetSample(r, initial_states_[(offset + r) % initial_states_.size()]);
+            }
+         }
+         std::function<bool()> is_finished = nullptr;
+         if (std::isfinite(time_limit_)) {
+            is_finished = [this]() { return IsTimeUp(); };
+         }
+         updater::ReplicaPackedSingleFlipUpdater<SystemType, RandType>(&system, num_sweeps, beta_list, seed_pair_list[i].second, update_method_, fast_acceptance_, is_finished);
+         // The packed systems do not track the energies, which are evaluated here only for the samples to be stored
+         for (std::int32_t r = 0; r < system.GetNumReplicas(); ++r) {
+            const auto sample = system.ExtractSample(r);
+            StoreSample(offset + r, sample, [this, &sample]() { return model_.CalculateEnergy(sample); });
+         }
       }
    }
    
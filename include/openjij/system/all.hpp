@@ -19,11 +19,15 @@
 
 #include "openjij/system/classical_ising.hpp"
 #include "openjij/system/classical_ising_polynomial.hpp"
+#include "openjij/system/compact_classical_ising.hpp"
 #include "openjij/system/continuous_time_ising.hpp"
 #include "openjij/system/k_local_polynomial.hpp"
 #include "openjij/system/transverse_ising.hpp"
 #include "openjij/system/binary_polynomial_sa_system.hpp"
 #include "openjij/system/ising_polynomial_sa_system.hpp"
+#include "openjij/system/replica_packed_classical_ising.hpp"
+#include "openjij/system/replica_packed_binary_polynomial_sa_system.hpp"
+#include "openjij/system/replica_packed_ising_polynomial_sa_system.hpp"
 #include "openjij/system/integer_quadratic_sa_system.hpp"
 #include "openjij/system/integer_polynomial_sa_system.hpp"
 
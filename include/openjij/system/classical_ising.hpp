@@ -81,12 +81,15 @@ template <typename FloatType> struct ClassicalIsing<graph::Dense<FloatType>> {
   }
 
   /**
-   * @brief reset dE
+   * @brief reset dE and energy
    *
    */
   inline void reset_dE() {
-    this->dE =
-        -2.0 * this->spin.array() * (this->interaction * this->spin).array();
+    const VectorXx local_field = this->interaction * this->spin;
+    this->dE = -2.0 * this->spin.array() * local_field.array();
+    this->energy = (this->spin.dot(local_field) -
+                    this->interaction.diagonal().sum()) /
+                   2.0;
   }
 
   /**
@@ -108,6 +111,12 @@ template <typename FloatType> struct ClassicalIsing<graph::Dense<FloatType>> {
    * @brief delta E for updater
    */
   VectorXx dE;
+
+  /**
+   * @brief energy of the current spin configuration, which the updaters keep
+   * up to date
+   */
+  FloatType energy;
 };
 
 /**
@@ -153,12 +162,15 @@ template <typename FloatType> struct ClassicalIsing<graph::Sparse<FloatType>> {
   }
 
   /**
-   * @brief reset dE
+   * @brief reset dE and energy
    *
    */
   void reset_dE() {
-    this->dE =
-        -2.0 * this->spin.array() * (this->interaction * this->spin).array();
+    const VectorXx local_field = this->interaction * this->spin;
+    this->dE = -2.0 * this->spin.array() * local_field.array();
+    this->energy = (this->spin.dot(local_field) -
+                    this->interaction.diagonal().sum()) /
+                   2.0;
   }
 
   /**
@@ -180,6 +192,12 @@ template <typename FloatType> struct ClassicalIsing<graph::Sparse<FloatType>> {
    * @brief delta E for updater
    */
   VectorXx dE;
+
+  /**
+   * @brief energy of the current spin configuration, which the updaters keep
+   * up to date
+   */
+  FloatType energy;
 };
 
 /**
@@ -224,12 +242,15 @@ template <typename FloatType> struct ClassicalIsing<graph::CSRSparse<FloatType>>
   }
 
   /**
-   * @brief reset dE
+   * @brief reset dE and energy
    *
    */
   void reset_dE() {
-    this->dE =
-        -2.0 * this->spin.array() * (this->interaction * this->spin).array();
+    const VectorXx local_field = this->interaction * this->spin;
+    this->dE = -2.0 * this->spin.array() * local_field.array();
+    this->energy = (this->spin.dot(local_field) -
+                    this->interaction.diagonal().sum()) /
+                   2.0;
   }
 
   /**
@@ -251,6 +272,12 @@ template <typename FloatType> struct ClassicalIsing<graph::CSRSparse<FloatType>>
    * @brief delta E for updater
    */
   VectorXx dE;
+
+  /**
+   * @brief energy of the current spin configuration, which the updaters keep
+   * up to date
+   */
+  FloatType energy;
 };
 
 /**
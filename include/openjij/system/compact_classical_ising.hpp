@@ -0,0 +1,183 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <cimod/utilities.hpp>
+
+#include "openjij/graph/all.hpp"
+#include "openjij/system/system.hpp"
+#include "openjij/utility/simd.hpp"
+
+namespace openjij {
+namespace system {
+
+/**
+ * @brief classical Ising system which stores the interactions in float32 (or
+ * bfloat16) and the spins in int8, so that the bandwidth-bound update of dE
+ * reads a half (or a quarter) of the bytes of ClassicalIsing per coupling.
+ * dE is kept in float, while the energy is accumulated in FloatType.
+ *
+ * @tparam GraphType type of graph
+ * @tparam StorageType type of the stored interactions (float or
+ * utility::BFloat16)
+ */
+template <typename GraphType, typename StorageType = float>
+struct CompactClassicalIsing;
+
+/**
+ * @brief CompactClassicalIsing structure for Dense graph
+ *
+ * @tparam FloatType type of floating-point
+ * @tparam StorageType type of the stored interactions
+ */
+template <typename FloatType, typename StorageType>
+struct CompactClassicalIsing<graph::Dense<FloatType>, StorageType> {
+  using system_type = classical_system;
+
+  /**
+   * @brief Constructor to initialize spin and interaction
+   *
+   * @param init_spin
+   * @param init_interaction
+   */
+  CompactClassicalIsing(const graph::Spins &init_spin,
+                        const graph::Dense<FloatType> &init_interaction)
+      : num_spins(init_interaction.get_num_spins()) {
+    cimod::CheckVariables(init_spin, cimod::Vartype::SPIN);
+    assert(init_spin.size() == init_interaction.get_num_spins());
+    const auto &matrix = init_interaction.get_interactions();
+    const std::size_t size = num_spins + 1;
+    interaction.resize(size * size);
+    diagonal_sum = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      for (std::size_t j = 0; j < size; ++j) {
+        interaction[i * size + j] =
+            StorageType(static_cast<float>(matrix(i, j)));
+      }
+      diagonal_sum += utility::to_float(interaction[i * size + i]);
+    }
+    reset_spins(init_spin);
+  }
+
+  /**
+   * @brief reset spins
+   *
+   * @param init_spin
+   */
+  void reset_spins(const graph::Spins &init_spin) {
+    spin.resize(num_spins + 1);
+    for (std::size_t i = 0; i < num_spins; ++i) {
+      spin[i] = static_cast<std::int8_t>(init_spin[i]);
+    }
+    spin[num_spins] = 1;
+    reset_dE();
+  }
+
+  /**
+   * @brief reset dE and energy
+   *
+   */
+  void reset_dE() {
+    const std::size_t size = num_spins + 1;
+    dE.resize(size);
+    FloatType sum = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      const StorageType *row = &interaction[i * size];
+      FloatType local_field = 0;
+      for (std::size_t j = 0; j < size; ++j) {
+        local_field += utility::to_float(row[j]) * spin[j];
+      }
+      dE[i] = static_cast<float>(-2 * spin[i] * local_field);
+      sum += spin[i] * local_field;
+    }
+    energy = (sum - diagonal_sum) / 2;
+    num_sweeps_since_reset = 0;
+  }
+
+  /**
+   * @brief interaction of the row i and the column j, stored at
+   * i*(num_spins+1)+j
+   */
+  const StorageType *row(const std::size_t i) const {
+    return &interaction[i * (num_spins + 1)];
+  }
+
+  /**
+   * @brief spins, where the last one is the dummy spin
+   */
+  std::vector<std::int8_t> spin;
+
+  /**
+   * @brief interactions in row-major order
+   */
+  std::vector<StorageType> interaction;
+
+  /**
+   * @brief number of real spins (dummy spin excluded)
+   */
+  const std::size_t num_spins;
+
+  /**
+   * @brief sum of the diagonal interactions
+   */
+  FloatType diagonal_sum;
+
+  /**
+   * @brief delta E for updater
+   */
+  std::vector<float> dE;
+
+  /**
+   * @brief energy of the current spin configuration, which the updaters keep
+   * up to date
+   */
+  FloatType energy;
+
+  /**
+   * @brief number of sweeps after which the updaters recompute dE and energy
+   * by reset_dE, which bounds the drift of the float accumulation
+   */
+  static constexpr std::size_t reset_interval = 64;
+
+  /**
+   * @brief number of sweeps since the last reset_dE
+   */
+  std::size_t num_sweeps_since_reset = 0;
+};
+
+/**
+ * @brief helper function for CompactClassicalIsing constructor
+ *
+ * @tparam StorageType type of the stored interactions
+ * @tparam GraphType
+ * @param init_spin initial spin
+ * @param init_interaction initial interaction
+ *
+ * @return generated object
+ */
+template <typename StorageType = float, typename GraphType>
+auto make_compact_classical_ising(const graph::Spins &init_spin,
+                                  const GraphType &init_interaction) {
+  return CompactClassicalIsing<GraphType, StorageType>(init_spin,
+                                                       init_interaction);
+}
+
+} // namespace system
+} // namespace openjij
@@ -30,7 +30,12 @@ class IntegerSASystem<graph::IntegerPolynomialModel, RandType> {
 public:
   IntegerSASystem(const graph::IntegerPolynomialModel &model,
                   const typename RandType::result_type seed)
-      : model(model), seed(seed), random_number_engine(seed) {
+      : IntegerSASystem(model, seed, RandType(seed)) {}
+
+  IntegerSASystem(const graph::IntegerPolynomialModel &model,
+                  const typename RandType::result_type seed,
+                  const RandType &random_number_engine)
+      : model(model), seed(seed), random_number_engine(random_number_engine) {
 
     const std::int64_t num_variables = model.GetNumVariables();
 
@@ -58,28 +63,35 @@ public:
         if (x == 0) {
           count++;
         } else {
-          prod *= std::pow(x, degree);
+          prod *= Power(x, degree);
         }
       }
       this->zero_count_[i] = count;
       this->term_prod_[i] = prod;
     }
 
-    // Initialize energy difference
-    this->base_energy_difference_.resize(num_variables);
+    // Initialize energy difference, whose coefficients of each variable are
+    // stored contiguously from degree 1 to the max degree of the variable
+    const auto &max_degree = this->model.GetEachVariableDegree();
+    this->coeff_offset_.resize(num_variables + 1);
+    this->coeff_offset_[0] = 0;
+    for (std::int64_t i = 0; i < num_variables; ++i) {
+      this->coeff_offset_[i + 1] = this->coeff_offset_[i] + max_degree[i];
+    }
+    this->base_energy_difference_.resize(this->coeff_offset_.back(), 0.0);
     for (std::size_t i = 0; i < num_terms; ++i) {
       const double value = key_value_list[i].second;
       for (const auto &[index, degree] : key_value_list[i].first) {
         const auto x = this->state_[index].value;
         if (x == 0) {
           if (this->zero_count_[i] == 1) {
-            this->base_energy_difference_[index][degree] +=
+            this->Coeff(index, degree) +=
                 value * this->term_prod_[i];
           }
         } else {
           if (this->zero_count_[i] == 0) {
-            this->base_energy_difference_[index][degree] +=
-                value * this->term_prod_[i] / std::pow(x, degree);
+            this->Coeff(index, degree) +=
+                value * (this->term_prod_[i] / Power(x, degree));
           }
         }
       }
@@ -93,7 +105,7 @@ public:
     for (const auto &term : key_value_list) {
       double prod = 1.0;
       for (const auto &[index, degree] : term.first) {
-        prod *= std::pow(state[index].value, degree);
+        prod *= Power(state[index].value, degree);
       }
       energy += term.second * prod;
     }
@@ -101,85 +113,94 @@ public:
   }
 
   std::int64_t GenerateCandidateValue(std::int64_t index) {
-    return this->state_[index].GenerateCandidateValue(
-        this->random_number_engine);
+    return this->GenerateCandidateValue(index, this->random_number_engine);
+  }
+
+  // Same as above, but the random numbers are drawn from the given engine
+  template <class Engine>
+  std::int64_t GenerateCandidateValue(std::int64_t index,
+                                      Engine &random_number_engine) const {
+    return this->state_[index].GenerateCandidateValue(random_number_engine);
   }
 
   double GetEnergyDifference(std::int64_t index, std::int64_t new_value) const {
     double dE = 0.0;
-    const auto current_value = this->state_[index].value;
-    for (const auto &[degree, value] : this->base_energy_difference_[index]) {
-      dE += value *
-            (std::pow(new_value, degree) - std::pow(current_value, degree));
+    const double current_value = this->state_[index].value;
+    double new_pow = 1.0;
+    double current_pow = 1.0;
+    for (std::size_t i = this->coeff_offset_[index];
+         i < this->coeff_offset_[index + 1]; ++i) {
+      new_pow *= new_value;
+      current_pow *= current_value;
+      dE += this->base_energy_difference_[i] * (new_pow - current_pow);
     }
     return dE;
   }
 
+  // If atomic is true, the energy and the coefficients of the neighbors are
+  // added atomically to set the variables of a color in parallel.
+  template <bool atomic = false>
   void SetValue(std::int64_t index, std::int64_t new_value) {
     const auto current_value = this->state_[index].value;
     if (current_value == new_value) {
       return;
     }
 
-    this->energy_ += this->GetEnergyDifference(index, new_value);
+    // The variables of a color may be set by the other threads at the same
+    // time, which share no term with this one but may share neighbors
+    const auto add = [](double &x, const double value) {
+      if constexpr (atomic) {
+#pragma omp atomic
+        x += value;
+      } else {
+        x += value;
+      }
+    };
+
+    add(this->energy_, this->GetEnergyDifference(index, new_value));
     this->state_[index].SetValue(new_value);
 
     const auto &interactions = this->model.GetIndexToInteractions().at(index);
     const auto &key_value_list = this->model.GetKeyValueList();
 
-    if (current_value != 0 && new_value != 0) {
-      for (const auto &[cons_ind, degree] : interactions) {
-        const double a =
-            std::pow(static_cast<double>(new_value) / current_value, degree);
-        const double ddE = (a - 1) * key_value_list[cons_ind].second *
-                           this->term_prod_[cons_ind];
-        this->term_prod_[cons_ind] *= a;
-        const int total_count = this->zero_count_[cons_ind];
-        for (const auto &[i, d] : key_value_list[cons_ind].first) {
-          if (i != index) {
-            if (this->state_[i].value == 0 && total_count == 1) {
-              this->base_energy_difference_[i][d] += ddE;
-            } else if (this->state_[i].value != 0 && total_count == 0) {
-              this->base_energy_difference_[i][d] +=
-                  ddE / std::pow(this->state_[i].value, d);
-            }
-          }
-        }
-      }
-    } else if (current_value == 0 && new_value != 0) {
-      for (const auto &[cons_ind, degree] : interactions) {
+    // term_prod_ holds the exact integer product of the nonzero factors, so
+    // that dividing it by a factor is also exact.
+    for (const auto &[cons_ind, degree] : interactions) {
+      const double old_prod = this->term_prod_[cons_ind];
+      double new_prod = old_prod;
+      int total_count = this->zero_count_[cons_ind];
+      if (current_value != 0) {
+        new_prod /= Power(current_value, degree);
+      } else {
         this->zero_count_[cons_ind]--;
-        const int total_count = this->zero_count_[cons_ind];
-        const double b = std::pow(new_value, degree);
-        const double ddE =
-            b * key_value_list[cons_ind].second * this->term_prod_[cons_ind];
-        this->term_prod_[cons_ind] *= b;
-        for (const auto &[i, d] : key_value_list[cons_ind].first) {
-          if (i != index) {
-            if (this->state_[i].value == 0 && total_count == 1) {
-              this->base_energy_difference_[i][d] += ddE;
-            } else if (this->state_[i].value != 0 && total_count == 0) {
-              this->base_energy_difference_[i][d] +=
-                  ddE / std::pow(this->state_[i].value, d);
-            }
-          }
-        }
+        total_count--;
       }
-    } else { // current_value != 0 && new_value == 0
-      for (const auto &[cons_ind, degree] : interactions) {
-        const int total_count = this->zero_count_[cons_ind];
+      if (new_value != 0) {
+        new_prod *= Power(new_value, degree);
+      } else {
         this->zero_count_[cons_ind]++;
-        const double ddE =
-            -key_value_list[cons_ind].second * this->term_prod_[cons_ind];
-        this->term_prod_[cons_ind] /= std::pow(current_value, degree);
-        for (const auto &[i, d] : key_value_list[cons_ind].first) {
-          if (i != index) {
-            if (this->state_[i].value == 0 && total_count == 1) {
-              this->base_energy_difference_[i][d] += ddE;
-            } else if (this->state_[i].value != 0 && total_count == 0) {
-              this->base_energy_difference_[i][d] +=
-                  ddE / std::pow(this->state_[i].value, d);
-            }
+      }
+      this->term_prod_[cons_ind] = new_prod;
+
+      // Change of the product of the factors other than index, which is
+      // nonzero only while index is the only zero factor or none is zero
+      double delta_prod;
+      if (current_value != 0 && new_value != 0) {
+        delta_prod = new_prod - old_prod;
+      } else if (current_value == 0) {
+        delta_prod = new_prod;
+      } else {
+        delta_prod = -old_prod;
+      }
+
+      const double value = key_value_list[cons_ind].second;
+      for (const auto &[i, d] : key_value_list[cons_ind].first) {
+        if (i != index) {
+          if (this->state_[i].value == 0 && total_count == 1) {
+            add(this->Coeff(i, d), value * delta_prod);
+          } else if (this->state_[i].value != 0 && total_count == 0) {
+            add(this->Coeff(i, d),
+                value * (delta_prod / Power(this->state_[i].value, d)));
           }
         }
       }
@@ -187,61 +208,42 @@ public:
   }
 
   std::pair<int, double> GetMinEnergyDifference(std::int64_t index) {
+    return this->GetMinEnergyDifference(index, this->random_number_engine);
+  }
+
+  // Same as above, but ties are broken by the given engine
+  template <class Engine>
+  std::pair<int, double>
+  GetMinEnergyDifference(std::int64_t index,
+                         Engine &random_number_engine) const {
     const auto &x = this->state_[index];
     const std::int64_t dxl = x.lower_bound - x.value;
     const std::int64_t dxu = x.upper_bound - x.value;
 
     if (this->UnderQuadraticCoeff(index)) {
-      auto it_a = this->base_energy_difference_[index].find(2);
-      const double a = (it_a != this->base_energy_difference_[index].end())
-                           ? it_a->second
-                           : 0.0;
-      auto it_b = this->base_energy_difference_[index].find(1);
-      const double b = (it_b != this->base_energy_difference_[index].end())
-                                ? it_b->second
-                                : 0.0;
+      const double a = this->GetCoeff(index, 2);
+      const double b = this->GetCoeff(index, 1);
 
       const double aa = a;
       const double bb = b + 2 * x.value * a;
 
-      return utility::FindMinimumIntegerQuadratic(aa, bb, dxl, dxu, x.value, this->random_number_engine);
+      return utility::FindMinimumIntegerQuadratic(aa, bb, dxl, dxu, x.value, random_number_engine);
     }
     else if (this->IsCubicCoeff(index)) {
-      auto it_a = this->base_energy_difference_[index].find(3);
-      const double a = (it_a != this->base_energy_difference_[index].end())
-                           ? it_a->second
-                           : 0.0;
-      auto it_b = this->base_energy_difference_[index].find(2);
-      const double b = (it_b != this->base_energy_difference_[index].end())
-                                ? it_b->second
-                                : 0.0;
-      auto it_c = this->base_energy_difference_[index].find(1);
-      const double c = (it_c != this->base_energy_difference_[index].end())
-                                ? it_c->second
-                                : 0.0;
+      const double a = this->GetCoeff(index, 3);
+      const double b = this->GetCoeff(index, 2);
+      const double c = this->GetCoeff(index, 1);
 
       const double aa = a;
       const double bb = 3 * a * x.value + b;
       const double cc = 3 * a * x.value * x.value + 2 * b * x.value + c;
 
-      return utility::FindMinimumIntegerCubic(aa, bb, cc, dxl, dxu, x.value, this->random_number_engine);
+      return utility::FindMinimumIntegerCubic(aa, bb, cc, dxl, dxu, x.value, random_number_engine);
     } else if (this->IsQuarticCoeff(index)) {
-      auto it_a = this->base_energy_difference_[index].find(4);
-      const double a = (it_a != this->base_energy_difference_[index].end())
-                           ? it_a->second
-                           : 0.0;
-      auto it_b = this->base_energy_difference_[index].find(3);
-      const double b = (it_b != this->base_energy_difference_[index].end())
-                                ? it_b->second
-                                : 0.0;
-      auto it_c = this->base_energy_difference_[index].find(2);
-      const double c = (it_c != this->base_energy_difference_[index].end())
-                                ? it_c->second
-                                : 0.0;
-      auto it_d = this->base_energy_difference_[index].find(1);
-      const double d = (it_d != this->base_energy_difference_[index].end())
-                                ? it_d->second
-                                : 0.0;
+      const double a = this->GetCoeff(index, 4);
+      const double b = this->GetCoeff(index, 3);
+      const double c = this->GetCoeff(index, 2);
+      const double d = this->GetCoeff(index, 1);
 
       const double aa = a;
       const double bb = 4 * a * x.value + b;
@@ -249,7 +251,7 @@ public:
       const double dd = 4 * a * x.value * x.value * x.value +
                         3 * b * x.value * x.value + 2 * c * x.value + d;
                         
-      return utility::FindMinimumIntegerQuartic(aa, bb, cc, dd, dxl, dxu, x.value, this->random_number_engine);
+      return utility::FindMinimumIntegerQuartic(aa, bb, cc, dd, dxl, dxu, x.value, random_number_engine);
     } else {
       double min_dE = std::numeric_limits<double>::infinity();
       std::int64_t min_value = -1;
@@ -270,13 +272,8 @@ public:
   }
 
   double GetLinearCoeff(std::int64_t index) const {
-    auto it1 = this->base_energy_difference_[index].find(1);
-    double c1 =
-        (it1 != this->base_energy_difference_[index].end()) ? it1->second : 0.0;
-
-    auto it2 = this->base_energy_difference_[index].find(2);
-    double c2 =
-        (it2 != this->base_energy_difference_[index].end()) ? it2->second : 0.0;
+    const double c1 = this->GetCoeff(index, 1);
+    const double c2 = this->GetCoeff(index, 2);
 
     return c1 + 2 * this->state_[index].value * c2;
   }
@@ -317,7 +314,28 @@ private:
   double energy_;
   std::vector<int> zero_count_;
   std::vector<double> term_prod_;
-  std::vector<std::unordered_map<std::int64_t, double>> base_energy_difference_;
+  std::vector<std::size_t> coeff_offset_;
+  std::vector<double> base_energy_difference_;
+
+  // Exact for representable results and cheaper than std::pow for the small
+  // degrees that appear in practice.
+  static double Power(const std::int64_t x, std::int64_t degree) {
+    double result = 1.0;
+    const double base = static_cast<double>(x);
+    for (; degree > 0; --degree) {
+      result *= base;
+    }
+    return result;
+  }
+
+  double &Coeff(const std::int64_t index, const std::int64_t degree) {
+    return this->base_energy_difference_[this->coeff_offset_[index] + degree - 1];
+  }
+
+  double GetCoeff(const std::int64_t index, const std::int64_t degree) const {
+    const std::size_t i = this->coeff_offset_[index] + degree - 1;
+    return i < this->coeff_offset_[index + 1] ? this->base_energy_difference_[i] : 0.0;
+  }
 };
 
 } // namespace system
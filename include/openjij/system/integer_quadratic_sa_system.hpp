@@ -29,7 +29,12 @@ class IntegerSASystem<graph::IntegerQuadraticModel, RandType> {
 public:
   IntegerSASystem(const graph::IntegerQuadraticModel &model,
                   const typename RandType::result_type seed)
-      : model(model), seed(seed), random_number_engine(seed) {
+      : IntegerSASystem(model, seed, RandType(seed)) {}
+
+  IntegerSASystem(const graph::IntegerQuadraticModel &model,
+                  const typename RandType::result_type seed,
+                  const RandType &random_number_engine)
+      : model(model), seed(seed), random_number_engine(random_number_engine) {
 
     const std::int64_t num_variables = model.GetNumVariables();
 
@@ -49,12 +54,14 @@ public:
     this->linear_coeff_.resize(num_variables, 0.0);
 
     const auto &linear = this->model.GetLinear();
-    const auto &quadratic = this->model.GetQuadratic();
+    const auto &offset_list = this->model.GetQuadraticOffsetList();
+    const auto &index_list = this->model.GetQuadraticIndexList();
+    const auto &value_list = this->model.GetQuadraticValueList();
 
     for (std::int64_t row = 0; row < num_variables; ++row) {
       double dE = linear[row] + 2.0 * squared[row] * this->state_[row].value;
-      for (const auto &[col, value] : quadratic[row]) {
-        dE += value * this->state_[col].value;
+      for (std::size_t k = offset_list[row]; k < offset_list[row + 1]; ++k) {
+        dE += value_list[k] * this->state_[index_list[k]].value;
       }
       this->linear_coeff_[row] = dE;
     }
@@ -65,23 +72,31 @@ public:
     double energy = this->model.GetConstant();
     const auto &linear = this->model.GetLinear();
     const auto &squared = this->model.GetSquared();
-    const auto &quadratic = this->model.GetQuadratic();
+    const auto &offset_list = this->model.GetQuadraticOffsetList();
+    const auto &index_list = this->model.GetQuadraticIndexList();
+    const auto &value_list = this->model.GetQuadraticValueList();
     const std::int64_t num_variables = this->model.GetNumVariables();
 
     for (std::int64_t i = 0; i < num_variables; ++i) {
       auto x = state[i].value;
       energy += linear[i] * x + squared[i] * x * x;
-      for (const auto &[j, value] : quadratic[i]) {
-        auto y = state[j].value;
-        energy += 0.5 * value * x * y;
+      for (std::size_t k = offset_list[i]; k < offset_list[i + 1]; ++k) {
+        auto y = state[index_list[k]].value;
+        energy += 0.5 * value_list[k] * x * y;
       }
     }
     return energy;
   }
 
   std::int64_t GenerateCandidateValue(std::int64_t index) {
-    return this->state_[index].GenerateCandidateValue(
-        this->random_number_engine);
+    return this->GenerateCandidateValue(index, this->random_number_engine);
+  }
+
+  // Same as above, but the random numbers are drawn from the given engine
+  template <class Engine>
+  std::int64_t GenerateCandidateValue(std::int64_t index,
+                                      Engine &random_number_engine) const {
+    return this->state_[index].GenerateCandidateValue(random_number_engine);
   }
 
   double GetEnergyDifference(std::int64_t index, std::int64_t new_value) const {
@@ -89,24 +104,48 @@ public:
     return this->quad_coeff_[index] * d * d + this->linear_coeff_[index] * d;
   }
 
+  // If atomic is true, the energy and the coefficients of the neighbors are
+  // added atomically to set the variables of a color in parallel.
+  template <bool atomic = false>
   void SetValue(std::int64_t index, std::int64_t new_value) {
     if (this->state_[index].value == new_value) {
       return;
     }
 
-    this->energy_ += this->GetEnergyDifference(index, new_value);
+    // The variables of a color may be set by the other threads at the same
+    // time, which share no term with this one but may share neighbors
+    const auto add = [](double &x, const double value) {
+      if constexpr (atomic) {
+#pragma omp atomic
+        x += value;
+      } else {
+        x += value;
+      }
+    };
+
+    add(this->energy_, this->GetEnergyDifference(index, new_value));
     std::int64_t dx = new_value - this->state_[index].value;
     this->linear_coeff_[index] += 2.0 * this->model.GetSquared()[index] * dx;
 
-    const auto &quadratic = this->model.GetQuadratic();
-    for (const auto &[i, q] : quadratic[index]) {
-      this->linear_coeff_[i] += q * dx;
+    const auto &offset_list = this->model.GetQuadraticOffsetList();
+    const auto &index_list = this->model.GetQuadraticIndexList();
+    const auto &value_list = this->model.GetQuadraticValueList();
+    for (std::size_t k = offset_list[index]; k < offset_list[index + 1]; ++k) {
+      add(this->linear_coeff_[index_list[k]], value_list[k] * dx);
     }
 
     this->state_[index].SetValue(new_value);
   }
 
   std::pair<int, double> GetMinEnergyDifference(std::int64_t index) {
+    return this->GetMinEnergyDifference(index, this->random_number_engine);
+  }
+
+  // Same as above, but ties are broken by the given engine
+  template <class Engine>
+  std::pair<int, double>
+  GetMinEnergyDifference(std::int64_t index,
+                         Engine &random_number_engine) const {
     const double a = this->quad_coeff_[index];
     const double b = this->linear_coeff_[index];
     const auto &x = this->state_[index];
@@ -147,7 +186,7 @@ public:
                               this->GetEnergyDifference(index, x.upper_bound));
       } else {
         const std::int64_t random_value =
-            x.GenerateRandomValue(this->random_number_engine);
+            x.GenerateRandomValue(random_number_engine);
         return std::make_pair(random_value, 0.0);
       }
     } else {
@@ -184,7 +223,7 @@ public:
   }
 
 public:
-  const graph::IntegerQuadraticModel model;
+  const graph::IntegerQuadraticModel &model;
   const std::int64_t seed;
   RandType random_number_engine;
 
@@ -41,11 +41,19 @@ public:
    //! @brief Constructor of SASystem for IsingPolynomialModel.
    //! @param model The IsingPolynomialModel.
    //! @param seed The seed for initializing binary variables.
-   SASystem(const ModelType &model, const SeedType seed):
+   SASystem(const ModelType &model, const SeedType seed): SASystem(model, RandType(seed)) {}
+   
+   //! @brief Constructor of SASystem for IsingPolynomialModel.
+   //! @param model The IsingPolynomialModel.
+   //! @param random_number_engine The random number engine for initializing binary variables.
+   SASystem(const ModelType &model, RandType random_number_engine):
    system_size_(model.GetSystemSize()),
-   key_value_list_(model.GetKeyValueList()),
-   adjacency_list_(model.GetAdjacencyList()) {
-      SetRandomConfiguration(seed);
+   key_offset_list_(model.GetKeyOffsetList()),
+   key_index_list_(model.GetKeyIndexList()),
+   value_list_(model.GetValueList()),
+   adjacency_offset_list_(model.GetAdjacencyOffsetList()),
+   adjacency_key_list_(model.GetAdjacencyKeyList()) {
+      SetRandomConfiguration(random_number_engine);
       SetTermProd();
       SetBaseEnergyDifference();
    }
@@ -67,11 +75,14 @@ public:
    //! @brief Flip a variable.
    //! @param index The index of the variable to be flipped.
    void Flip(const std::int32_t index) {
+      energy_ += GetEnergyDifference(index);
       sample_[index] *= -1;
-      for (const auto &index_key: adjacency_list_[index]) {
-         const ValueType val = -2*key_value_list_[index_key].second*term_prod_[index_key];
+      for (std::size_t i = adjacency_offset_list_[index]; i < adjacency_offset_list_[index + 1]; ++i) {
+         const std::int32_t index_key = adjacency_key_list_[i];
+         const ValueType val = -2*value_list_[index_key]*term_prod_[index_key];
          term_prod_[index_key] *= -1;
-         for (const auto &v_index: key_value_list_[index_key].first) {
+         for (std::size_t j = key_offset_list_[index_key]; j < key_offset_list_[index_key + 1]; ++j) {
+            const std::int32_t v_index = key_index_list_[j];
             if (v_index != index) {
                base_energy_difference_[v_index] += val*sample_[v_index];
             }
@@ -79,6 +90,29 @@ public:
       }
    }
    
+   //! @brief Flip a variable, where the other variables of its color may be flipped by the other threads at the same time.
+   //! Since such variables share no term, only the energy and the energy differences of the neighbors are added atomically.
+   //! @param index The index of the variable.
+   void FlipAtomic(const std::int32_t index) {
+      const ValueType delta_energy = GetEnergyDifference(index);
+#pragma omp atomic
+      energy_ += delta_energy;
+      sample_[index] *= -1;
+      for (std::size_t i = adjacency_offset_list_[index]; i < adjacency_offset_list_[index + 1]; ++i) {
+         const std::int32_t index_key = adjacency_key_list_[i];
+         const ValueType val = -2*value_list_[index_key]*term_prod_[index_key];
+         term_prod_[index_key] *= -1;
+         for (std::size_t j = key_offset_list_[index_key]; j < key_offset_list_[index_key + 1]; ++j) {
+            const std::int32_t v_index = key_index_list_[j];
+            if (v_index != index) {
+               const ValueType diff = val*sample_[v_index];
+#pragma omp atomic
+               base_energy_difference_[v_index] += diff;
+            }
+         }
+      }
+   }
+   
    //! @brief Get the system size.
    //! @return The system size.
    std::int32_t GetSystemSize() const {
@@ -91,6 +125,12 @@ public:
       return sample_;
    }
    
+   //! @brief Get the energy of the current sample, which is updated in each flip.
+   //! @return The energy.
+   ValueType GetEnergy() const {
+      return energy_;
+   }
+   
    //! @brief Get the energy difference when flipped and sample as list.
    //! @return The energy difference and sample.
    const std::vector<ValueType> &GetBaseEnergyDifference() const {
@@ -104,32 +144,59 @@ public:
       return -2*sample_[index]*base_energy_difference_[index];
    }
    
+   //! @brief Get the offsets of the keys in the flattened key index list.
+   //! @return The key offset list.
+   const std::vector<std::size_t> &GetKeyOffsetList() const {
+      return key_offset_list_;
+   }
+   
+   //! @brief Get the flattened indices of the variables in the interactions.
+   //! @return The key index list.
+   const std::vector<std::int32_t> &GetKeyIndexList() const {
+      return key_index_list_;
+   }
+   
+   //! @brief Get the offsets of the adjacency in the flattened adjacency key list.
+   //! @return The adjacency offset list.
+   const std::vector<std::size_t> &GetAdjacencyOffsetList() const {
+      return adjacency_offset_list_;
+   }
+   
+   //! @brief Get the flattened integer indices of the interactions including each variable.
+   //! @return The adjacency key list.
+   const std::vector<std::int32_t> &GetAdjacencyKeyList() const {
+      return adjacency_key_list_;
+   }
+   
 private:
    const std::int32_t system_size_;
-   const std::vector<std::pair<std::vector<std::int32_t>, ValueType>> &key_value_list_;
-   const std::vector<std::vector<std::size_t>> &adjacency_list_;
+   const std::vector<std::size_t> &key_offset_list_;
+   const std::vector<std::int32_t> &key_index_list_;
+   const std::vector<ValueType> &value_list_;
+   const std::vector<std::size_t> &adjacency_offset_list_;
+   const std::vector<std::int32_t> &adjacency_key_list_;
    
    std::vector<VariableType> sample_;
    std::vector<ValueType> base_energy_difference_;
    std::vector<short> term_prod_;
+   ValueType energy_ = 0;
    
    //! @brief Set initial binary variables.
-   //! @param seed The seed for initializing binary variables.
-   void SetRandomConfiguration(const SeedType seed) {
+   //! @param random_number_engine The random number engine.
+   void SetRandomConfiguration(RandType &random_number_engine) {
       sample_.resize(system_size_);
       std::uniform_int_distribution<short> dist(0, 1);
-      RandType random_number_engine(seed);
       for (std::int32_t i = 0; i < system_size_; i++) {
          sample_[i] = 2*dist(random_number_engine) - 1;
       }
    }
    
    void SetTermProd() {
-      term_prod_.resize(key_value_list_.size());
-      for (std::size_t i = 0; i < key_value_list_.size(); ++i) {
+      term_prod_.resize(value_list_.size());
+      for (std::size_t i = 0; i < value_list_.size(); ++i) {
          short prod = 1;
-         for (const auto &index: key_value_list_[i].first) {
-            prod *= sample_[index];
+         for (std::size_t j = key_offset_list_[i]; j < key_offset_list_[i + 1]; ++j) {
+            prod *= sample_[key_index_list_[j]];
          }
          term_prod_[i] = prod;
       }
@@ -138,9 +205,12 @@ private:
    void SetBaseEnergyDifference() {
       base_energy_difference_.clear();
       base_energy_difference_.resize(system_size_);
-      for (std::size_t i = 0; i < key_value_list_.size(); ++i) {
-         const ValueType value = key_value_list_[i].second;
-         for (const auto &index: key_value_list_[i].first) {
+      energy_ = 0;
+      for (std::size_t i = 0; i < value_list_.size(); ++i) {
+         const ValueType value = value_list_[i];
+         energy_ += value*term_prod_[i];
+         for (std::size_t j = key_offset_list_[i]; j < key_offset_list_[i + 1]; ++j) {
+            const std::int32_t index = key_index_list_[j];
             base_energy_difference_[index] += value*term_prod_[i]*sample_[index];
          }
       }
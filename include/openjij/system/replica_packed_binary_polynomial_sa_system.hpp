@@ -0,0 +1,187 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <random>
+#include "./sa_system.hpp"
+
+namespace openjij {
+namespace system {
+
+//! @brief SASystem for BinaryPolynomialModel, which holds up to 64 replicas in one word per variable.
+//! The i-th bit of the word for a variable is set when the variable of the i-th replica is 1.
+//! @tparam FloatType The value type.
+//! @tparam RandType The random number engine.
+template<typename FloatType, typename RandType>
+class ReplicaPackedSASystem<graph::BinaryPolynomialModel<FloatType>, RandType> {
+   
+   //! @brief The model type, which must be BinaryPolynomialModel.
+   using ModelType = graph::BinaryPolynomialModel<FloatType>;
+   
+   //! @brief The variable type, which here represents binary variables \f$ x_i\in \{0, 1\} \f$
+   using VariableType = typename ModelType::VariableType;
+   
+   //! @brief The type of seed in random number engine.
+   using SeedType = typename RandType::result_type;
+   
+public:
+   //! @brief The value type.
+   using ValueType = typename ModelType::ValueType;
+   
+   //! @brief The word type, which packs the replicas.
+   using WordType = std::uint64_t;
+   
+   //! @brief The maximum number of replicas.
+   constexpr static std::int32_t max_num_replicas = 64;
+   
+   //! @brief Constructor of ReplicaPackedSASystem for BinaryPolynomialModel.
+   //! @param model The BinaryPolynomialModel.
+   //! @param num_replicas The number of replicas, which must be in [1, 64].
+   //! @param seed The seed for initializing variables.
+   ReplicaPackedSASystem(const ModelType &model, const std::int32_t num_replicas, const SeedType seed):
+   system_size_(model.GetSystemSize()),
+   num_replicas_(num_replicas),
+   replica_mask_(GenerateReplicaMask(num_replicas)),
+   key_offset_list_(model.GetKeyOffsetList()),
+   key_index_list_(model.GetKeyIndexList()),
+   value_list_(model.GetValueList()),
+   adjacency_offset_list_(model.GetAdjacencyOffsetList()),
+   adjacency_key_list_(model.GetAdjacencyKeyList()) {
+      SetRandomConfiguration(seed);
+   }
+   
+   //! @brief Set the variables of a replica.
+   //! @param replica The index of the replica.
+   //! @param sample The variables.
+   void SetSample(const std::int32_t replica, const std::vector<VariableType> &sample) {
+      if (replica < 0 || replica >= num_replicas_) {
+         throw std::runtime_error("The index of the replica is out of range.");
+      }
+      if (static_cast<std::int32_t>(sample.size()) != system_size_) {
+         throw std::runtime_error("The size of initial variables is not equal to the system size.");
+      }
+      const WordType mask = WordType(1) << replica;
+      for (std::int32_t i = 0; i < system_size_; ++i) {
+         if (!(sample[i] == 0 || sample[i] == 1)) {
+            throw std::runtime_error("The initial variables must be 0 or 1.");
+         }
+         const bool bit = sample[i] == 1;
+         if (bit != static_cast<bool>(sample_[i] & mask)) {
+            Flip(i, mask);
+         }
+      }
+   }
+   
+   //! @brief Flip a variable in the replicas specified by the mask.
+   //! @param index The index of the variable to be flipped.
+   //! @param mask The i-th bit is set when the variable of the i-th replica is flipped.
+   void Flip(const std::int32_t index, const WordType mask) {
+      sample_[index] ^= mask;
+   }
+   
+   //! @brief Get the system size.
+   //! @return The system size.
+   std::int32_t GetSystemSize() const {
+      return system_size_;
+   }
+   
+   //! @brief Get the number of replicas.
+   //! @return The number of replicas.
+   std::int32_t GetNumReplicas() const {
+      return num_replicas_;
+   }
+   
+   //! @brief Extract the sample of a replica.
+   //! @param replica The index of the replica.
+   //! @return The sample.
+   std::vector<VariableType> ExtractSample(const std::int32_t replica) const {
+      std::vector<VariableType> sample(system_size_);
+      for (std::int32_t i = 0; i < system_size_; ++i) {
+         sample[i] = static_cast<VariableType>((sample_[i] >> replica) & 1);
+      }
+      return sample;
+   }
+   
+   //! @brief Get the energy difference when flipped for all the replicas.
+   //! @param index The index of variables.
+   //! @return The energy differences, the i-th element of which is that of the i-th replica.
+   //! Only the first GetNumReplicas() elements are computed.
+   const std::array<ValueType, max_num_replicas> &GetEnergyDifference(const std::int32_t index) {
+      // dE = (1 - 2*x_i)*sum_k J_k*prod_{j in k, j != i} x_j
+      std::fill(delta_energy_.begin(), delta_energy_.begin() + num_replicas_, 0);
+      for (std::size_t i = adjacency_offset_list_[index]; i < adjacency_offset_list_[index + 1]; ++i) {
+         const std::int32_t index_key = adjacency_key_list_[i];
+         const ValueType value = value_list_[index_key];
+         WordType active = replica_mask_;
+         for (std::size_t j = key_offset_list_[index_key]; j < key_offset_list_[index_key + 1]; ++j) {
+            const std::int32_t v_index = key_index_list_[j];
+            if (v_index != index) {
+               active &= sample_[v_index];
+            }
+         }
+         if (active == 0) {
+            continue;
+         }
+         for (std::int32_t r = 0; r < num_replicas_; ++r) {
+            delta_energy_[r] += value*static_cast<ValueType>((active >> r) & 1);
+         }
+      }
+      const WordType state = sample_[index];
+      for (std::int32_t r = 0; r < num_replicas_; ++r) {
+         delta_energy_[r] *= 1 - 2*static_cast<ValueType>((state >> r) & 1);
+      }
+      return delta_energy_;
+   }
+   
+private:
+   const std::int32_t system_size_;
+   const std::int32_t num_replicas_;
+   const WordType replica_mask_;
+   const std::vector<std::size_t> &key_offset_list_;
+   const std::vector<std::int32_t> &key_index_list_;
+   const std::vector<ValueType> &value_list_;
+   const std::vector<std::size_t> &adjacency_offset_list_;
+   const std::vector<std::int32_t> &adjacency_key_list_;
+   
+   std::vector<WordType> sample_;
+   std::array<ValueType, max_num_replicas> delta_energy_;
+   
+   static WordType GenerateReplicaMask(const std::int32_t num_replicas) {
+      if (num_replicas <= 0 || num_replicas > max_num_replicas) {
+         throw std::runtime_error("num_replicas must be in [1, 64].");
+      }
+      return num_replicas == max_num_replicas ? ~WordType(0) : (WordType(1) << num_replicas) - 1;
+   }
+   
+   //! @brief Set initial variables.
+   //! @param seed The seed for initializing variables.
+   void SetRandomConfiguration(const SeedType seed) {
+      sample_.resize(system_size_);
+      std::uniform_int_distribution<WordType> dist;
+      RandType random_number_engine(seed);
+      for (std::int32_t i = 0; i < system_size_; i++) {
+         sample_[i] = dist(random_number_engine) & replica_mask_;
+      }
+   }
+   
+};
+
+
+} // namespace system
+} // namespace openjij
@@ -0,0 +1,175 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <cimod/utilities.hpp>
+
+#include "openjij/graph/all.hpp"
+#include "openjij/system/system.hpp"
+
+namespace openjij {
+namespace system {
+
+/**
+ * @brief classical Ising system holding several replicas which share one
+ * interaction matrix. The spins and the local fields are stored as
+ * (num_spins+1) x num_replicas matrices, so that a single spin flip of the
+ * variable i in any subset of the replicas is one rank-1 update of the local
+ * fields by the row i of the interaction matrix, which is read once for all
+ * the replicas.
+ *
+ * @tparam GraphType type of graph
+ */
+template <typename GraphType> struct ReplicaPackedClassicalIsing;
+
+/**
+ * @brief ReplicaPackedClassicalIsing structure for Dense graph (Eigen-based)
+ *
+ * @tparam FloatType type of floating-point
+ */
+template <typename FloatType>
+struct ReplicaPackedClassicalIsing<graph::Dense<FloatType>> {
+  using system_type = classical_system;
+
+  // matrix (row major)
+  using MatrixXx =
+      Eigen::Matrix<FloatType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  // vector (col major)
+  using VectorXx = Eigen::Matrix<FloatType, Eigen::Dynamic, 1, Eigen::ColMajor>;
+
+  /**
+   * @brief Constructor to initialize spins and interaction
+   *
+   * @param init_spins initial spins of each replica
+   * @param init_interaction
+   */
+  ReplicaPackedClassicalIsing(const std::vector<graph::Spins> &init_spins,
+                              const graph::Dense<FloatType> &init_interaction)
+      : interaction(init_interaction.get_interactions()),
+        num_spins(init_interaction.get_num_spins()),
+        num_replicas(init_spins.size()) {
+    if (num_replicas == 0) {
+      throw std::runtime_error("The number of replicas must be positive.");
+    }
+    reset_spins(init_spins);
+  }
+
+  /**
+   * @brief reset spins
+   *
+   * @param init_spins initial spins of each replica
+   */
+  void reset_spins(const std::vector<graph::Spins> &init_spins) {
+    if (init_spins.size() != num_replicas) {
+      throw std::runtime_error(
+          "The number of spin configurations is not equal to the number of "
+          "replicas.");
+    }
+    this->spin.resize(num_spins + 1, num_replicas);
+    for (std::size_t r = 0; r < num_replicas; ++r) {
+      cimod::CheckVariables(init_spins[r], cimod::Vartype::SPIN);
+      assert(init_spins[r].size() == num_spins);
+      for (std::size_t i = 0; i < num_spins; ++i) {
+        this->spin(i, r) = init_spins[r][i];
+      }
+      this->spin(num_spins, r) = 1;
+    }
+    reset_dE();
+  }
+
+  /**
+   * @brief reset local fields and energies
+   *
+   */
+  void reset_dE() {
+    this->local_field.noalias() = this->interaction * this->spin;
+    this->energy = (((this->spin.array() * this->local_field.array())
+                         .colwise()
+                         .sum()
+                         .transpose() -
+                     this->interaction.diagonal().sum()) /
+                    2.0)
+                       .matrix();
+  }
+
+  /**
+   * @brief energy difference of flipping a spin in a replica
+   *
+   * @param i index of the spin
+   * @param r index of the replica
+   *
+   * @return energy difference
+   */
+  FloatType dE(const std::size_t i, const std::size_t r) const {
+    return -2 * this->spin(i, r) * this->local_field(i, r);
+  }
+
+  /**
+   * @brief spins, whose column r is the replica r and whose last row is the
+   * dummy spin
+   */
+  MatrixXx spin;
+
+  /**
+   * @brief interactions (Eigen Matrix)
+   */
+  const MatrixXx interaction;
+
+  /**
+   * @brief number of real spins (dummy spin excluded)
+   */
+  const std::size_t num_spins;
+
+  /**
+   * @brief number of replicas
+   */
+  const std::size_t num_replicas;
+
+  /**
+   * @brief local fields interaction * spin of each replica
+   */
+  MatrixXx local_field;
+
+  /**
+   * @brief energy of each replica, which the updaters keep up to date
+   */
+  VectorXx energy;
+};
+
+/**
+ * @brief helper function for ReplicaPackedClassicalIsing constructor
+ *
+ * @tparam GraphType
+ * @param init_spins initial spins of each replica
+ * @param init_interaction initial interaction
+ *
+ * @return generated object
+ */
+template <typename GraphType>
+auto make_replica_packed_classical_ising(
+    const std::vector<graph::Spins> &init_spins,
+    const GraphType &init_interaction) {
+  return ReplicaPackedClassicalIsing<GraphType>(init_spins, init_interaction);
+}
+
+} // namespace system
+} // namespace openjij
@@ -23,6 +23,9 @@ class SASystem;
 template<class ModelType, typename RandType>
 class IntegerSASystem;
 
+template<class ModelType, typename RandType>
+class ReplicaPackedSASystem;
+
 
 } // namespace system
 } // namespace openjij
@@ -18,9 +18,11 @@
 #include "openjij/utility/disable_eigen_warning.hpp"
 
 #include "openjij/updater/continuous_time_swendsen_wang.hpp"
+#include "openjij/updater/houdayer.hpp"
 #include "openjij/updater/k_local.hpp"
 #include "openjij/updater/single_spin_flip.hpp"
 #include "openjij/updater/swendsen_wang.hpp"
+#include "openjij/updater/wolff.hpp"
 #include "openjij/updater/single_integer_move.hpp"
 
 #ifdef USE_CUDA
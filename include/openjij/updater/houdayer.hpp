@@ -0,0 +1,129 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "openjij/graph/graph.hpp"
+#include "openjij/system/classical_ising.hpp"
+#include "openjij/updater/single_spin_flip.hpp"
+#include "openjij/utility/union_find.hpp"
+
+namespace openjij {
+namespace updater {
+
+/**
+ * @brief houdayer isoenergetic cluster updater
+ *
+ * @tparam System
+ */
+template <typename System> struct Houdayer;
+
+/**
+ * @brief houdayer isoenergetic cluster updater for a pair of classical ising
+ * systems with the same sparse interactions at the same temperature. The
+ * spins at which the two replicas disagree are grouped into clusters along
+ * the interactions, and a cluster chosen at random is flipped in both
+ * replicas. The sum of the energies of the replicas is unchanged by the flip,
+ * which is therefore always accepted.
+ *
+ * @tparam System type of system (ClassicalIsing with Sparse or CSRSparse)
+ */
+template <typename System> struct SparseHoudayer {
+  using FloatType = typename System::VectorXx::Scalar;
+
+  /**
+   * @brief flip a cluster of the disagreeing spins in both replicas
+   *
+   * @param system_a object of a classical ising system
+   * @param system_b object of a classical ising system with the same
+   * interactions as system_a
+   * @param random_number_engine random number gengine
+   *
+   * @return the number of spins flipped in each replica
+   */
+  template <typename RandomNumberEngine>
+  inline static std::size_t update(System &system_a, System &system_b,
+                                   RandomNumberEngine &random_number_engine) {
+    const std::size_t num_spins = system_a.num_spins;
+
+    // 1. find the spins with the negative overlap
+    std::vector<std::size_t> disagreement_list;
+    for (std::size_t node = 0; node < num_spins; ++node) {
+      if (system_a.spin(node) != system_b.spin(node)) {
+        disagreement_list.push_back(node);
+      }
+    }
+    if (disagreement_list.empty()) {
+      return 0;
+    }
+
+    // 2. unite the adjacent spins with the negative overlap, where the dummy
+    // spin always has the positive one
+    auto union_find_tree = utility::UnionFind(num_spins);
+    for (const std::size_t node : disagreement_list) {
+      for (typename System::SparseMatrixXx::InnerIterator it(
+               system_a.interaction, node);
+           it; ++it) {
+        const std::size_t adj_node = it.index();
+        if (node >= adj_node || adj_node >= num_spins || it.value() == 0)
+          continue;
+        if (system_a.spin(adj_node) != system_b.spin(adj_node))
+          union_find_tree.unite_sets(node, adj_node);
+      }
+    }
+
+    // 3. flip the cluster of a random disagreeing spin in both replicas,
+    // which updates the energy and dE of each replica
+    auto uid = std::uniform_int_distribution<std::size_t>(
+        0, disagreement_list.size() - 1);
+    const auto root =
+        union_find_tree.find_set(disagreement_list[uid(random_number_engine)]);
+
+    std::size_t cluster_size = 0;
+    for (const std::size_t node : disagreement_list) {
+      if (union_find_tree.find_set(node) == root) {
+        SparseSingleSpinFlip<System>::flip(system_a, node);
+        SparseSingleSpinFlip<System>::flip(system_b, node);
+        ++cluster_size;
+      }
+    }
+    return cluster_size;
+  }
+};
+
+/**
+ * @brief houdayer updater for classical ising model (on Sparse graph)
+ *
+ * @tparam FloatType
+ */
+template <typename FloatType>
+struct Houdayer<system::ClassicalIsing<graph::Sparse<FloatType>>>
+    : public SparseHoudayer<system::ClassicalIsing<graph::Sparse<FloatType>>> {
+};
+
+/**
+ * @brief houdayer updater for classical ising model (on CSR Sparse graph)
+ *
+ * @tparam FloatType
+ */
+template <typename FloatType>
+struct Houdayer<system::ClassicalIsing<graph::CSRSparse<FloatType>>>
+    : public SparseHoudayer<
+          system::ClassicalIsing<graph::CSRSparse<FloatType>>> {};
+} // namespace updater
+} // namespace openjij
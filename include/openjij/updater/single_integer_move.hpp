@@ -15,6 +15,9 @@
 
 #include <random>
 
+#include "openjij/utility/fast_exp.hpp"
+#include "openjij/utility/random.hpp"
+
 namespace openjij {
 namespace updater {
 
@@ -22,37 +25,67 @@ struct MetropolisUpdater {
   template <typename SystemType>
   std::int64_t GenerateNewValue(SystemType &sa_system, const std::int64_t index,
                                 const double T, const double _progress) {
-    const auto candidate_value = sa_system.GenerateCandidateValue(index);
+    return GenerateNewValue(sa_system, index, T, _progress,
+                            sa_system.random_number_engine);
+  }
+
+  // Same as above, but the random numbers are drawn from the given engine
+  template <typename SystemType, typename RandType>
+  std::int64_t GenerateNewValue(const SystemType &sa_system,
+                                const std::int64_t index, const double T,
+                                const double _progress,
+                                RandType &random_number_engine) {
+    const auto candidate_value = sa_system.GenerateCandidateValue(index, random_number_engine);
     const double dE = sa_system.GetEnergyDifference(index, candidate_value);
-    if (dE <= 0.0 || dist(sa_system.random_number_engine) < std::exp(-dE / T)) {
+    if (Accept(dE, T, random_number_engine)) {
       return candidate_value;
     } else {
       return sa_system.GetState()[index].value;
     }
   }
 
-  std::uniform_real_distribution<double> dist{0.0, 1.0};
+  // The default test keeps the random stream of std::exp, while the fast one
+  // uses utility::metropolis_accept<true>
+  template <typename RandType>
+  bool Accept(const double dE, const double T, RandType &random_number_engine) {
+    if (fast_acceptance) {
+      return utility::metropolis_accept<true>(1.0 / T, dE, dist,
+                                              random_number_engine);
+    }
+    return dE <= 0.0 || dist(random_number_engine) < std::exp(-dE / T);
+  }
+
+  utility::UniformRealDistribution<double> dist;
+  bool fast_acceptance = false;
 };
 
 struct OptMetropolisUpdater {
   template <typename SystemType>
   std::int64_t GenerateNewValue(SystemType &sa_system, const std::int64_t index,
                                 const double T, const double progress) {
+    return GenerateNewValue(sa_system, index, T, progress,
+                            sa_system.random_number_engine);
+  }
+
+  // Same as above, but the random numbers are drawn from the given engine
+  template <typename SystemType, typename RandType>
+  std::int64_t GenerateNewValue(const SystemType &sa_system,
+                                const std::int64_t index, const double T,
+                                const double progress,
+                                RandType &random_number_engine) {
     // Metropolis Optimal Transition if possible
     // This is used for systems with up to 4th power coefficients
-    if (sa_system.CanOptMove(index) && dist(sa_system.random_number_engine) < progress) {
-      const auto [min_val, min_dE] = sa_system.GetMinEnergyDifference(index);
-      if (min_dE <= 0.0 ||
-          dist(sa_system.random_number_engine) < std::exp(-min_dE / T)) {
+    if (sa_system.CanOptMove(index) && dist(random_number_engine) < progress) {
+      const auto [min_val, min_dE] = sa_system.GetMinEnergyDifference(index, random_number_engine);
+      if (Accept(min_dE, T, random_number_engine)) {
         return min_val;
       } else {
         return sa_system.GetState()[index].value;
       }
     } else {
-      const auto candidate_value = sa_system.GenerateCandidateValue(index);
+      const auto candidate_value = sa_system.GenerateCandidateValue(index, random_number_engine);
       const double dE = sa_system.GetEnergyDifference(index, candidate_value);
-      if (dE <= 0.0 ||
-          dist(sa_system.random_number_engine) < std::exp(-dE / T)) {
+      if (Accept(dE, T, random_number_engine)) {
         return candidate_value;
       } else {
         return sa_system.GetState()[index].value;
@@ -60,23 +93,45 @@ struct OptMetropolisUpdater {
     }
   }
 
-  std::uniform_real_distribution<double> dist{0.0, 1.0};
+  // Same as MetropolisUpdater::Accept
+  template <typename RandType>
+  bool Accept(const double dE, const double T, RandType &random_number_engine) {
+    if (fast_acceptance) {
+      return utility::metropolis_accept<true>(1.0 / T, dE, dist,
+                                              random_number_engine);
+    }
+    return dE <= 0.0 || dist(random_number_engine) < std::exp(-dE / T);
+  }
+
+  utility::UniformRealDistribution<double> dist;
+  bool fast_acceptance = false;
 };
 
 struct HeatBathUpdater {
   template <typename SystemType>
   std::int64_t GenerateNewValue(SystemType &sa_system, const std::int64_t index,
                                 const double T, const double _progress) {
+    return GenerateNewValue(sa_system, index, T, _progress,
+                            sa_system.random_number_engine);
+  }
+
+  // Same as above, but the random numbers are drawn from the given engine
+  template <typename SystemType, typename RandType>
+  std::int64_t GenerateNewValue(const SystemType &sa_system,
+                                const std::int64_t index, const double T,
+                                const double _progress,
+                                RandType &random_number_engine) {
     if (sa_system.IsLinearCoeff(index)) {
-      return ForBilinear(sa_system, index, T, _progress);
+      return ForBilinear(sa_system, index, T, _progress, random_number_engine);
     } else {
-      return ForAll(sa_system, index, T, _progress);
+      return ForAll(sa_system, index, T, _progress, random_number_engine);
     }
   }
 
-  template <typename SystemType>
-  std::int64_t ForAll(SystemType &sa_system, const std::int64_t index,
-                      const double T, const double _progress) {
+  template <typename SystemType, typename RandType>
+  std::int64_t ForAll(const SystemType &sa_system, const std::int64_t index,
+                      const double T, const double _progress,
+                      RandType &random_number_engine) {
     const auto &var = sa_system.GetState()[index];
     const double beta = 1.0 / T;
     std::int64_t selected_state_number = -1;
@@ -84,7 +139,7 @@ struct HeatBathUpdater {
 
     for (std::int64_t i = 0; i < var.num_states; ++i) {
       const double g =
-          -std::log(-std::log(dist(sa_system.random_number_engine)));
+          -std::log(-std::log(dist(random_number_engine)));
       const double z = -beta * sa_system.GetEnergyDifference(
                                    index, var.GetValueFromState(i)) + g;
       if (z > max_z) {
@@ -98,28 +153,30 @@ struct HeatBathUpdater {
     return var.GetValueFromState(selected_state_number);
   }
 
-  template <typename SystemType>
-  std::int64_t ForBilinear(SystemType &sa_system,
+  template <typename SystemType, typename RandType>
+  std::int64_t ForBilinear(const SystemType &sa_system,
                           const std::int64_t index, const double T,
-                          const double _progress) {
+                          const double _progress,
+                          RandType &random_number_engine) {
       const auto &state = sa_system.GetState()[index];
       const double linear_coeff = sa_system.GetLinearCoeff(index);
 
       if (std::abs(linear_coeff) < 1e-10) {
-          return state.GenerateRandomValue(sa_system.random_number_engine);
+          return state.GenerateRandomValue(random_number_engine);
       }
 
       const double b = -linear_coeff * (1.0 / T);
       const double dxl = static_cast<double>(state.lower_bound - state.value);
       const double dxu = static_cast<double>(state.upper_bound - state.value);
 
-      const double u = this->dist(sa_system.random_number_engine);
+      const double u = this->dist(random_number_engine);
 
       double selected_dz = 0.0;
+      // Both exponents are non-positive, so that fast_exp only underflows
       if (b > 0) {
-          selected_dz = dxu + std::log(u + (1.0 - u) * std::exp(-b * (dxu - dxl + 1))) / b;
+          selected_dz = dxu + std::log(u + (1.0 - u) * Exp(-b * (dxu - dxl + 1))) / b;
       } else {
-          selected_dz = dxl - 1.0 + std::log(1.0 - u * (1.0 - std::exp(b * (dxu - dxl + 1)))) / b;
+          selected_dz = dxl - 1.0 + std::log(1.0 - u * (1.0 - Exp(b * (dxu - dxl + 1)))) / b;
       }
 
       selected_dz = static_cast<std::int64_t>(std::ceil(std::max(dxl, std::min(selected_dz, dxu))));
@@ -127,25 +184,41 @@ struct HeatBathUpdater {
       return state.value + selected_dz;
   }
 
-  std::uniform_real_distribution<double> dist{0.0, 1.0};
+  double Exp(const double x) const {
+    return fast_acceptance ? utility::fast_exp(x) : std::exp(x);
+  }
+
+  utility::UniformRealDistribution<double> dist;
+  bool fast_acceptance = false;
 };
 
 struct SuwaTodoUpdater {
   template <typename SystemType>
   std::int64_t GenerateNewValue(SystemType &sa_system, const std::int64_t index,
                                 const double T, const double _progress) {
+    return GenerateNewValue(sa_system, index, T, _progress,
+                            sa_system.random_number_engine);
+  }
+
+  // Same as above, but the random numbers are drawn from the given engine
+  template <typename SystemType, typename RandType>
+  std::int64_t GenerateNewValue(const SystemType &sa_system,
+                                const std::int64_t index, const double T,
+                                const double _progress,
+                                RandType &random_number_engine) {
     const auto &var = sa_system.GetState()[index];
     const std::int64_t max_num_state = var.num_states;
     std::vector<double> weight_list(max_num_state, 0.0);
     std::vector<double> sum_weight_list(max_num_state, 0.0);
 
-    const auto [max_weight_state_value, min_dE] = sa_system.GetMinEnergyDifference(index);
+    const auto [max_weight_state_value, min_dE] = sa_system.GetMinEnergyDifference(index, random_number_engine);
     const auto max_weight_state = var.GetStateFromValue(max_weight_state_value);
 
     for (std::int64_t i = 0; i < max_num_state; ++i) {
       const std::int64_t state = (i == 0) ? max_weight_state : ((i == max_weight_state) ? 0 : i);
       const double dE = sa_system.GetEnergyDifference(index, var.GetValueFromState(state)) - min_dE;
-      weight_list[i] = std::exp(-dE / T);
+      weight_list[i] =
+          fast_acceptance ? utility::fast_exp(-dE / T) : std::exp(-dE / T);
       sum_weight_list[i] = (i == 0) ? weight_list[i] : sum_weight_list[i - 1] + weight_list[i];
     }
 
@@ -159,7 +232,7 @@ struct SuwaTodoUpdater {
     const double w_0 = weight_list[0];
     const double w_c = weight_list[current_state];
     const double sum_w_c = sum_weight_list[current_state];
-    const double rand = dist(sa_system.random_number_engine) * w_c;
+    const double rand = dist(random_number_engine) * w_c;
     std::int64_t selected_state = -1;
     double prob_sum = 0.0;
 
@@ -185,7 +258,8 @@ struct SuwaTodoUpdater {
     return var.GetValueFromState(selected_state);
   }
 
-  std::uniform_real_distribution<double> dist{0.0, 1.0};
+  utility::UniformRealDistribution<double> dist;
+  bool fast_acceptance = false;
 };
 
 } // namespace updater
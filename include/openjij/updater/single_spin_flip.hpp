@@ -13,12 +13,24 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
 #include <random>
 #include <type_traits>
+#include <vector>
 
 #include "openjij/system/classical_ising.hpp"
+#include "openjij/system/compact_classical_ising.hpp"
+#include "openjij/system/replica_packed_classical_ising.hpp"
 #include "openjij/system/transverse_ising.hpp"
+#include "openjij/utility/fast_exp.hpp"
+#include "openjij/utility/fenwick_tree.hpp"
+#include "openjij/utility/graph_coloring.hpp"
+#include "openjij/utility/random.hpp"
 #include "openjij/utility/schedule_list.hpp"
+#include "openjij/utility/simd.hpp"
 #include "openjij/algorithm/algorithm.hpp"
 
 #ifdef USE_OMP
@@ -38,7 +50,8 @@ template <typename System> struct SingleSpinFlip;
 /**
  * @brief single spin flip for classical ising model (with Eigen implementation)
  *
- * @tparam GraphType graph type (assume Dense<FloatType> or Sparse<FloatType>)
+ * @tparam GraphType graph type (assume Dense<FloatType>; the sparse graphs are
+ * specialized with SparseSingleSpinFlip)
  */
 template <typename GraphType>
 struct SingleSpinFlip<system::ClassicalIsing<GraphType>> {
@@ -67,9 +80,24 @@ struct SingleSpinFlip<system::ClassicalIsing<GraphType>> {
   inline static void
   update(ClIsing &system, RandomNumberEngine &random_number_engine,
          const utility::ClassicalUpdaterParameter &parameter) {
+    update_impl<false>(system, random_number_engine, parameter);
+  }
+
+  /**
+   * @brief operate single spin flip in a classical ising system
+   *
+   * @tparam fast_acceptance use utility::metropolis_accept in the fast mode
+   * @param system object of a classical ising system
+   * @param random_number_engine random number gengine
+   * @param parameter parameter object including inverse temperature
+   */
+  template <bool fast_acceptance, typename RandomNumberEngine>
+  inline static void
+  update_impl(ClIsing &system, RandomNumberEngine &random_number_engine,
+              const utility::ClassicalUpdaterParameter &parameter) {
     // set probability distribution object
     // to do Metroopolis
-    auto urd = std::uniform_real_distribution<>(0, 1.0);
+    auto urd = utility::UniformRealDistribution<double>();
 
     Eigen::setNbThreads(1);
     Eigen::initParallel();
@@ -77,9 +105,10 @@ struct SingleSpinFlip<system::ClassicalIsing<GraphType>> {
     // do a iteraction except for the auxiliary spin
     for (std::size_t index = 0; index < system.num_spins; ++index) {
 
-      if (system.dE(index) <= 0 ||
-          std::exp(-parameter.beta * system.dE(index)) >
-              urd(random_number_engine)) {
+      if (utility::metropolis_accept<fast_acceptance>(
+              parameter.beta, system.dE(index), urd, random_number_engine)) {
+        system.energy += system.dE(index);
+
         // update dE
         system.dE += 4 * system.spin(index) *
                      (system.interaction.row(index).transpose().cwiseProduct(
@@ -95,6 +124,305 @@ struct SingleSpinFlip<system::ClassicalIsing<GraphType>> {
   }
 };
 
+/**
+ * @brief single spin flip for classical ising model with sparse interactions,
+ * which runs over the raw CSR arrays of the row-major interaction matrix so
+ * that a flip touches only the neighbors of the flipped spin. The neighbor
+ * spins are read from an int8 copy of the spins, which the updater keeps
+ * per thread and refreshes from the spins at each update.
+ *
+ * @tparam System type of system (ClassicalIsing with Sparse or CSRSparse)
+ */
+template <typename System> struct SparseSingleSpinFlip {
+
+  /**
+   * @brief float type
+   */
+  using FloatType = typename System::VectorXx::Scalar;
+
+  /**
+   * @brief operate single spin flip in a classical ising system
+   *
+   * @param system object of a classical ising system
+   * @param random_number_engine random number gengine
+   * @param parameter parameter object including inverse temperature
+   */
+  template <typename RandomNumberEngine>
+  inline static void
+  update(System &system, RandomNumberEngine &random_number_engine,
+         const utility::ClassicalUpdaterParameter &parameter) {
+    update_impl<false>(system, random_number_engine, parameter);
+  }
+
+  /**
+   * @brief operate single spin flip in a classical ising system
+   *
+   * @tparam fast_acceptance use utility::metropolis_accept in the fast mode
+   * @param system object of a classical ising system
+   * @param random_number_engine random number gengine
+   * @param parameter parameter object including inverse temperature
+   */
+  template <bool fast_acceptance, typename RandomNumberEngine>
+  inline static void
+  update_impl(System &system, RandomNumberEngine &random_number_engine,
+              const utility::ClassicalUpdaterParameter &parameter) {
+    auto urd = utility::UniformRealDistribution<double>();
+
+    // assure that the dummy spin is not changed.
+    system.spin(system.num_spins) = 1;
+
+    // the storage is kept over the updates of the calling thread
+    thread_local std::vector<std::int8_t> spin_sign;
+    load_spin_sign(system, spin_sign);
+
+    const FloatType *dE = system.dE.data();
+    // do a iteraction except for the auxiliary spin
+    for (std::size_t index = 0; index < system.num_spins; ++index) {
+      if (utility::metropolis_accept<fast_acceptance>(
+              parameter.beta, dE[index], urd, random_number_engine)) {
+        flip(system, spin_sign.data(), index);
+      }
+    }
+  }
+
+  /**
+   * @brief copy the signs of the spins into an int8 array
+   *
+   * @param system object of a classical ising system
+   * @param spin_sign array resized to system.spin.size()
+   */
+  inline static void load_spin_sign(const System &system,
+                                    std::vector<std::int8_t> &spin_sign) {
+    const std::size_t size = static_cast<std::size_t>(system.spin.size());
+    spin_sign.resize(size);
+    const FloatType *spin = system.spin.data();
+    for (std::size_t i = 0; i < size; ++i) {
+      spin_sign[i] = spin[i] > 0 ? 1 : -1;
+    }
+  }
+
+  /**
+   * @brief flip a spin and update the energy and dE of its neighbors, which
+   * are read from the int8 copy of the spins
+   *
+   * @param system object of a classical ising system
+   * @param spin_sign signs of the spins given by load_spin_sign, which are
+   * kept up to date
+   * @param index index of the spin
+   */
+  inline static void flip(System &system, std::int8_t *spin_sign,
+                          const std::size_t index) {
+    update_dE(system, spin_sign, index);
+    system.spin(index) *= -1;
+    spin_sign[index] = -spin_sign[index];
+  }
+
+  /**
+   * @brief flip a spin and update the energy and dE of its neighbors, which
+   * are read from the spins of the system. This suits a few flips, for which
+   * the int8 copy does not pay off.
+   *
+   * @param system object of a classical ising system
+   * @param index index of the spin
+   */
+  inline static void flip(System &system, const std::size_t index) {
+    update_dE(system, system.spin.data(), index);
+    system.spin(index) *= -1;
+  }
+
+  /**
+   * @brief add the energy difference of flipping a spin to the energy and
+   * update dE of the spin and its neighbors
+   *
+   * @param system object of a classical ising system
+   * @param spin spins before the flip
+   * @param index index of the spin
+   */
+  template <typename SpinType>
+  inline static void update_dE(System &system, const SpinType *spin,
+                               const std::size_t index) {
+    const auto &interaction = system.interaction;
+    const auto *outer = interaction.outerIndexPtr();
+    const auto *inner = interaction.innerIndexPtr();
+    const auto *inner_nonzeros = interaction.innerNonZeroPtr();
+    const FloatType *value = interaction.valuePtr();
+    FloatType *dE = system.dE.data();
+
+    system.energy += dE[index];
+
+    // update dE
+    const FloatType coeff = 4 * spin[index];
+    const auto begin = outer[index];
+    const auto end = inner_nonzeros == nullptr
+                         ? outer[index + 1]
+                         : outer[index] + inner_nonzeros[index];
+    for (auto k = begin; k < end; ++k) {
+      const auto j = inner[k];
+      dE[j] += coeff * (value[k] * spin[j]);
+    }
+
+    dE[index] *= -1;
+  }
+};
+
+template <typename FloatType>
+struct SingleSpinFlip<system::ClassicalIsing<graph::Sparse<FloatType>>>
+    : public SparseSingleSpinFlip<
+          system::ClassicalIsing<graph::Sparse<FloatType>>> {};
+
+template <typename FloatType>
+struct SingleSpinFlip<system::ClassicalIsing<graph::CSRSparse<FloatType>>>
+    : public SparseSingleSpinFlip<
+          system::ClassicalIsing<graph::CSRSparse<FloatType>>> {};
+
+/**
+ * @brief single spin flip for classical ising model with compact dense storage,
+ * where the row of the flipped spin is added to dE by utility::spin_axpy with
+ * the widest instruction set of the CPU
+ *
+ * @tparam FloatType type of floating-point
+ * @tparam StorageType type of the stored interactions
+ */
+template <typename FloatType, typename StorageType>
+struct SingleSpinFlip<
+    system::CompactClassicalIsing<graph::Dense<FloatType>, StorageType>> {
+
+  /**
+   * @brief CompactClassicalIsing with dense interactions
+   */
+  using ClIsing =
+      system::CompactClassicalIsing<graph::Dense<FloatType>, StorageType>;
+
+  /**
+   * @brief operate single spin flip in a classical ising system
+   *
+   * @param system object of a classical ising system
+   * @param random_number_engine random number gengine
+   * @param parameter parameter object including inverse temperature
+   */
+  template <typename RandomNumberEngine>
+  inline static void
+  update(ClIsing &system, RandomNumberEngine &random_number_engine,
+         const utility::ClassicalUpdaterParameter &parameter) {
+    update_impl<false>(system, random_number_engine, parameter);
+  }
+
+  /**
+   * @brief operate single spin flip in a classical ising system
+   *
+   * @tparam fast_acceptance use utility::metropolis_accept in the fast mode
+   * @param system object of a classical ising system
+   * @param random_number_engine random number gengine
+   * @param parameter parameter object including inverse temperature
+   */
+  template <bool fast_acceptance, typename RandomNumberEngine>
+  inline static void
+  update_impl(ClIsing &system, RandomNumberEngine &random_number_engine,
+              const utility::ClassicalUpdaterParameter &parameter) {
+    auto urd = utility::UniformRealDistribution<double>();
+    const auto level = utility::simd_level();
+    const std::size_t size = system.num_spins + 1;
+    std::int8_t *spin = system.spin.data();
+    float *dE = system.dE.data();
+
+    // do a iteraction except for the auxiliary spin
+    for (std::size_t index = 0; index < system.num_spins; ++index) {
+      if (utility::metropolis_accept<fast_acceptance>(
+              parameter.beta, dE[index], urd, random_number_engine)) {
+        system.energy += dE[index];
+
+        // update dE
+        utility::spin_axpy(level, 4.0f * spin[index], system.row(index), spin,
+                           dE, size);
+
+        dE[index] *= -1;
+        spin[index] = -spin[index];
+      }
+    }
+
+    if (++system.num_sweeps_since_reset == ClIsing::reset_interval) {
+      system.reset_dE();
+    }
+  }
+};
+
+/**
+ * @brief single spin flip for replica-packed classical ising model, which
+ * decides the flip of a spin in every replica and then updates the local
+ * fields of the flipped replicas by one rank-1 update with the row of the
+ * interaction matrix
+ *
+ * @tparam FloatType type of floating-point
+ */
+template <typename FloatType>
+struct SingleSpinFlip<
+    system::ReplicaPackedClassicalIsing<graph::Dense<FloatType>>> {
+
+  /**
+   * @brief ReplicaPackedClassicalIsing with dense interactions
+   */
+  using ClIsing =
+      system::ReplicaPackedClassicalIsing<graph::Dense<FloatType>>;
+
+  /**
+   * @brief operate single spin flip in all the replicas
+   *
+   * @param system object of a replica-packed classical ising system
+   * @param random_number_engine random number gengine
+   * @param parameter parameter object including inverse temperature
+   */
+  template <typename RandomNumberEngine>
+  inline static void
+  update(ClIsing &system, RandomNumberEngine &random_number_engine,
+         const utility::ClassicalUpdaterParameter &parameter) {
+    update_impl<false>(system, random_number_engine, parameter);
+  }
+
+  /**
+   * @brief operate single spin flip in all the replicas
+   *
+   * @tparam fast_acceptance use utility::metropolis_accept in the fast mode
+   * @param system object of a replica-packed classical ising system
+   * @param random_number_engine random number gengine
+   * @param parameter parameter object including inverse temperature
+   */
+  template <bool fast_acceptance, typename RandomNumberEngine>
+  inline static void
+  update_impl(ClIsing &system, RandomNumberEngine &random_number_engine,
+              const utility::ClassicalUpdaterParameter &parameter) {
+    auto urd = utility::UniformRealDistribution<double>();
+
+    Eigen::setNbThreads(1);
+    Eigen::initParallel();
+
+    // change of the spins of the flipped replicas, zero for the others
+    typename ClIsing::VectorXx delta(system.num_replicas);
+
+    // do a iteraction except for the auxiliary spin
+    for (std::size_t index = 0; index < system.num_spins; ++index) {
+      bool is_flipped = false;
+      for (std::size_t r = 0; r < system.num_replicas; ++r) {
+        const FloatType dE = system.dE(index, r);
+        if (utility::metropolis_accept<fast_acceptance>(
+                parameter.beta, dE, urd, random_number_engine)) {
+          system.energy(r) += dE;
+          delta(r) = -2 * system.spin(index, r);
+          system.spin(index, r) *= -1;
+          is_flipped = true;
+        } else {
+          delta(r) = 0;
+        }
+      }
+
+      // update the local fields by the row of the flipped spin
+      if (is_flipped) {
+        system.local_field.noalias() +=
+            system.interaction.row(index).transpose() * delta.transpose();
+      }
+    }
+  }
+};
+
 /**
  * @brief single spin flip for transverse field ising model (with Eigen
  * implementation)
@@ -128,6 +456,23 @@ struct SingleSpinFlip<system::TransverseIsing<GraphType>> {
   inline static void
   update(QIsing &system, RandomNumberEngine &random_number_engine,
          const utility::TransverseFieldUpdaterParameter &parameter) {
+    update_impl<false>(system, random_number_engine, parameter);
+  }
+
+  /**
+   * @brief operate single spin flip in a transverse ising system
+   *
+   * @tparam fast_acceptance use utility::fast_exp and skip the exponent above
+   * utility::FAST_EXP_CUTOFF
+   * @param system object of a transverse ising system
+   * @param random_number_engine random number engine
+   * @param parameter parameter object including inverse temperature
+   * \f\beta:=(k_B T)^{-1}\f and transverse magnetic field \f\s\f
+   */
+  template <bool fast_acceptance, typename RandomNumberEngine>
+  inline static void
+  update_impl(QIsing &system, RandomNumberEngine &random_number_engine,
+              const utility::TransverseFieldUpdaterParameter &parameter) {
 
     // get number of classical spins
     std::size_t num_classical_spins = system.num_classical_spins;
@@ -135,7 +480,7 @@ struct SingleSpinFlip<system::TransverseIsing<GraphType>> {
     std::size_t num_trotter_slices = system.trotter_spins.cols();
 
     // do metropolis
-    auto urd = std::uniform_real_distribution<>(0, 1.0);
+    auto urd = utility::UniformRealDistribution<double>();
 
     // aliases
     // const auto& spins = system.trotter_spins;
@@ -152,9 +497,8 @@ struct SingleSpinFlip<system::TransverseIsing<GraphType>> {
 
     // generate random number (col major)
     for (std::size_t t = 0; t < num_trotter_slices; t++) {
-      for (std::size_t i = 0; i < num_classical_spins; i++) {
-        system.rand_pool(i, t) = urd(random_number_engine);
-      }
+      urd.fill(random_number_engine, &system.rand_pool(0, t),
+               num_classical_spins);
     }
 
     // using OpenMP
@@ -169,7 +513,7 @@ struct SingleSpinFlip<system::TransverseIsing<GraphType>> {
     for (int64_t t = 0; t < (int64_t)upper_limit; t += 2) {
       for (int64_t i = 0; i < (int64_t)num_classical_spins; i++) {
         // calculate matrix dot product
-        do_calc(system, parameter, i, t, B);
+        do_calc<fast_acceptance>(system, parameter, i, t, B);
       }
     }
 
@@ -178,7 +522,7 @@ struct SingleSpinFlip<system::TransverseIsing<GraphType>> {
     for (int64_t t = 1; t < (int64_t)num_trotter_slices; t += 2) {
       for (int64_t i = 0; i < (int64_t)num_classical_spins; i++) {
         // calculate matrix dot product
-        do_calc(system, parameter, i, t, B);
+        do_calc<fast_acceptance>(system, parameter, i, t, B);
       }
     }
 
@@ -187,12 +531,13 @@ struct SingleSpinFlip<system::TransverseIsing<GraphType>> {
       int64_t t = (int64_t)(num_trotter_slices - 1);
       for (int64_t i = 0; i < (int64_t)num_classical_spins; i++) {
         // calculate matrix dot product
-        do_calc(system, parameter, i, t, B);
+        do_calc<fast_acceptance>(system, parameter, i, t, B);
       }
     }
   }
 
 private:
+  template <bool fast_acceptance>
   inline static void
   do_calc(QIsing &system,
           const utility::TransverseFieldUpdaterParameter &parameter, size_t i,
@@ -237,7 +582,15 @@ private:
 
     // metropolis
 
-    if (dE < 0 || exp(-dE) > system.rand_pool(i, t)) {
+    bool accept = false;
+    if (fast_acceptance) {
+      accept = dE < 0 || (dE < utility::FAST_EXP_CUTOFF<FloatType> &&
+                          utility::fast_exp(-dE) > system.rand_pool(i, t));
+    } else {
+      accept = dE < 0 || exp(-dE) > system.rand_pool(i, t);
+    }
+
+    if (accept) {
 
       // update dE (spatial direction)
       system.dE.col(t) +=
@@ -258,6 +611,199 @@ private:
   }
 };
 
+/**
+ * @brief single spin flip with the fast acceptance test, where the exponential
+ * is evaluated by utility::fast_exp and skipped if the exponent exceeds
+ * utility::FAST_EXP_CUTOFF
+ *
+ * @tparam System type of system (ClassicalIsing or TransverseIsing)
+ */
+template <typename System> struct FastSingleSpinFlip {
+  template <typename RandomNumberEngine>
+  inline static void
+  update(System &system, RandomNumberEngine &random_number_engine,
+         const utility::UpdaterParameter<
+             typename system::get_system_type<System>::type> &parameter) {
+    SingleSpinFlip<System>::template update_impl<true>(
+        system, random_number_engine, parameter);
+  }
+};
+
+/**
+ * @brief single spin flip for classical ising model with sparse interactions,
+ * which updates the spins of each color of the interaction graph at the same
+ * time. Since the spins of the same color do not interact, their Metropolis
+ * decisions do not depend on each other, which keeps detailed balance. The
+ * random numbers of a color are drawn in order, and then the spins are decided
+ * and flipped by num_threads threads, which add to dE of the shared neighbors
+ * atomically. The result depends on the number of threads only through the
+ * rounding order of these additions. The coloring is made once by
+ * generate_color_list and passed to each update together with the number of
+ * threads, so that it is shared by the reads.
+ *
+ * @tparam System type of system (ClassicalIsing with Sparse or CSRSparse)
+ */
+template <typename System> struct ColoredSingleSpinFlip {
+  using FloatType = typename System::VectorXx::Scalar;
+
+  /**
+   * @brief run the schedule as algorithm::Algorithm::run does
+   *
+   * @param system object of a classical ising system
+   * @param random_number_engine random number engine
+   * @param schedule_list schedule list
+   * @param color_list spins of each color given by generate_color_list
+   * @param num_threads number of threads, where 0 means the default number of
+   * OpenMP threads
+   */
+  template <typename RandomNumberEngine>
+  static void run(System &system, RandomNumberEngine &random_number_engine,
+                  const utility::ClassicalScheduleList &schedule_list,
+                  const std::vector<std::vector<std::size_t>> &color_list,
+                  const int num_threads) {
+    for (auto &&schedule : schedule_list) {
+      for (std::size_t i = 0; i < schedule.one_mc_step; ++i) {
+        update(system, random_number_engine, schedule.updater_parameter,
+               color_list, num_threads);
+      }
+    }
+  }
+
+  /**
+   * @brief operate the single spin flip of each color
+   *
+   * @param system object of a classical ising system
+   * @param random_number_engine random number engine
+   * @param parameter parameter object including inverse temperature
+   * @param color_list spins of each color given by generate_color_list
+   * @param num_threads number of threads, where 0 means the default number of
+   * OpenMP threads
+   */
+  template <typename RandomNumberEngine>
+  inline static void
+  update(System &system, RandomNumberEngine &random_number_engine,
+         const utility::ClassicalUpdaterParameter &parameter,
+         const std::vector<std::vector<std::size_t>> &color_list,
+         const int num_threads) {
+    auto urd = utility::UniformRealDistribution<double>();
+    std::size_t max_color_size = 0;
+    for (const auto &color : color_list) {
+      max_color_size = std::max(max_color_size, color.size());
+    }
+    std::vector<double> uniform_list(max_color_size);
+
+    thread_local std::vector<std::int8_t> spin_sign_storage;
+    SparseSingleSpinFlip<System>::load_spin_sign(system, spin_sign_storage);
+    std::int8_t *spin_sign = spin_sign_storage.data();
+    int color_num_threads = std::max(num_threads, 1);
+#ifdef USE_OMP
+    if (num_threads <= 0) {
+      color_num_threads = omp_get_max_threads();
+    }
+#endif
+
+    for (const auto &color : color_list) {
+      const std::int64_t color_size = static_cast<std::int64_t>(color.size());
+      urd.fill(random_number_engine, uniform_list.data(), color.size());
+
+      // A single thread flips the spins without the atomic additions
+      if (color_num_threads == 1) {
+        for (std::int64_t k = 0; k < color_size; ++k) {
+          if (utility::metropolis_accept<false>(
+                  parameter.beta, system.dE(color[k]), uniform_list[k])) {
+            SparseSingleSpinFlip<System>::flip(system, spin_sign, color[k]);
+          }
+        }
+        continue;
+      }
+
+      FloatType delta_energy = 0;
+#pragma omp parallel for schedule(static) reduction(+ : delta_energy) num_threads(color_num_threads)
+      for (std::int64_t k = 0; k < color_size; ++k) {
+        if (utility::metropolis_accept<false>(
+                parameter.beta, system.dE(color[k]), uniform_list[k])) {
+          delta_energy += flip_atomic(system, spin_sign, color[k]);
+        }
+      }
+      system.energy += delta_energy;
+    }
+  }
+
+  /**
+   * @brief flip a spin and add to dE of its neighbors atomically, where the
+   * other spins of the same color may be flipped at the same time
+   *
+   * @param system object of a classical ising system
+   * @param spin_sign signs of the spins, which are kept up to date
+   * @param index index of the spin
+   *
+   * @return energy difference of the flip
+   */
+  inline static FloatType flip_atomic(System &system, std::int8_t *spin_sign,
+                                      const std::size_t index) {
+    const auto &interaction = system.interaction;
+    const auto *outer = interaction.outerIndexPtr();
+    const auto *inner = interaction.innerIndexPtr();
+    const auto *inner_nonzeros = interaction.innerNonZeroPtr();
+    const FloatType *value = interaction.valuePtr();
+    FloatType *dE = system.dE.data();
+
+    const FloatType delta_energy = dE[index];
+
+    // update dE, where no other spin of the color is a neighbor
+    const FloatType coeff = 4 * spin_sign[index];
+    const auto begin = outer[index];
+    const auto end = inner_nonzeros == nullptr
+                         ? outer[index + 1]
+                         : outer[index] + inner_nonzeros[index];
+    FloatType self_diff = 0;
+    for (auto k = begin; k < end; ++k) {
+      const auto j = inner[k];
+      const FloatType diff = coeff * (value[k] * spin_sign[j]);
+      if (static_cast<std::size_t>(j) == index) {
+        self_diff += diff;
+      } else {
+#pragma omp atomic
+        dE[j] += diff;
+      }
+    }
+
+    dE[index] = -(delta_energy + self_diff);
+    system.spin(index) *= -1;
+    spin_sign[index] = -spin_sign[index];
+    return delta_energy;
+  }
+
+  /**
+   * @brief color the interaction graph of the real spins
+   *
+   * @param system object of a classical ising system
+   *
+   * @return spins of each color
+   */
+  static std::vector<std::vector<std::size_t>>
+  generate_color_list(const System &system) {
+    std::vector<std::vector<std::size_t>> neighbor_list(system.num_spins);
+    for (std::size_t i = 0; i < system.num_spins; ++i) {
+      for (typename System::SparseMatrixXx::InnerIterator it(
+               system.interaction, i);
+           it; ++it) {
+        const std::size_t j = it.index();
+        if (j != i && j < system.num_spins && it.value() != 0) {
+          neighbor_list[i].push_back(j);
+          neighbor_list[j].push_back(i);
+        }
+      }
+    }
+    for (auto &neighbors : neighbor_list) {
+      std::sort(neighbors.begin(), neighbors.end());
+      neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                      neighbors.end());
+    }
+    return utility::GreedyColoring(neighbor_list);
+  }
+};
+
 //! @brief Single spin flip for Ising models with polynomial interactions and
 //! polynomial unconstrained binary optimization models.
 //! @tparam GraphType graph type for Polynomial graph class
@@ -304,7 +850,7 @@ struct SingleSpinFlip<system::ClassicalIsingPolynomial<GraphType>> {
   update_spin(ClPIsing &system, RandomNumberEngine &random_number_engine,
               const utility::ClassicalUpdaterParameter &parameter) {
 
-    auto urd = std::uniform_real_distribution<>(0, 1.0);
+    auto urd = utility::UniformRealDistribution<double>();
     for (const auto &index_spin : system.get_active_variables()) {
       if (system.dE(index_spin) <= 0.0 ||
           std::exp(-parameter.beta * system.dE(index_spin)) >
@@ -325,7 +871,7 @@ struct SingleSpinFlip<system::ClassicalIsingPolynomial<GraphType>> {
   update_binary(ClPIsing &system, RandomNumberEngine &random_number_engine,
                 const utility::ClassicalUpdaterParameter &parameter) {
 
-    auto urd = std::uniform_real_distribution<>(0, 1.0);
+    auto urd = utility::UniformRealDistribution<double>();
     for (const auto &index_binary : system.get_active_variables()) {
       if (system.dE(index_binary) <= 0.0 ||
           std::exp(-parameter.beta * system.dE(index_binary)) >
@@ -337,26 +883,178 @@ struct SingleSpinFlip<system::ClassicalIsingPolynomial<GraphType>> {
 };
 
 
+//! @brief Generate the variables sharing an interaction with each variable of the polynomial SA systems.
+//! These are the variables whose energy differences change when the variable is flipped.
+template<class SystemType>
+std::vector<std::vector<std::int32_t>> GenerateNeighborList(const SystemType &system) {
+   const std::int32_t system_size = system.GetSystemSize();
+   const auto &key_offset_list = system.GetKeyOffsetList();
+   const auto &key_index_list = system.GetKeyIndexList();
+   const auto &adjacency_offset_list = system.GetAdjacencyOffsetList();
+   const auto &adjacency_key_list = system.GetAdjacencyKeyList();
+   std::vector<std::vector<std::int32_t>> neighbor_list(system_size);
+   for (std::int32_t i = 0; i < system_size; ++i) {
+      for (std::size_t a = adjacency_offset_list[i]; a < adjacency_offset_list[i + 1]; ++a) {
+         const std::int32_t index_key = adjacency_key_list[a];
+         for (std::size_t b = key_offset_list[index_key]; b < key_offset_list[index_key + 1]; ++b) {
+            if (key_index_list[b] != i) {
+               neighbor_list[i].push_back(key_index_list[b]);
+            }
+         }
+      }
+      std::sort(neighbor_list[i].begin(), neighbor_list[i].end());
+      neighbor_list[i].erase(std::unique(neighbor_list[i].begin(), neighbor_list[i].end()), neighbor_list[i].end());
+   }
+   return neighbor_list;
+}
+
+//! @brief Rejection-free (n-fold way) single flip updater.
+//! This is equivalent to the Metropolis update where each of the system_size proposals in a sweep picks a variable at random.
+//! Instead of drawing the rejected proposals one by one, the number of proposals until the next candidate flip is drawn from the geometric distribution,
+//! and the candidate is drawn in proportion to its acceptance probability with the Fenwick tree.
+//! The acceptance probabilities are kept at a reference inverse temperature, and only those of the flipped variable and its neighbors are updated after each flip.
+//! While the inverse temperature increases, a candidate is accepted with the ratio of the acceptance probabilities at the current and the reference inverse temperatures,
+//! and the tree is rebuilt only when these thinning rejections become frequent. Thus a sweep costs almost nothing once the system is frozen.
+//! Since a flip costs much more than in the Metropolis update, sequential Metropolis sweeps are used instead
+//! while the number of flips per sweep is too large for the rejection-free sweep to pay off.
+template<class SystemType, typename RandType>
+void RejectionFreeSingleFlipUpdater(SystemType *system,
+                                    const std::int32_t num_sweeps,
+                                    const std::vector<typename SystemType::ValueType> &beta_list,
+                                    RandType &random_number_engine,
+                                    const bool fast_acceptance,
+                                    const std::function<bool()> &is_finished = nullptr) {
+   
+   using ValueType = typename SystemType::ValueType;
+   const std::int32_t system_size = system->GetSystemSize();
+   if (system_size == 0) {
+      return;
+   }
+   
+   // Variables whose energy differences change when a variable is flipped
+   const auto neighbor_list = GenerateNeighborList(*system);
+   
+   const auto boltzmann_factor = [fast_acceptance](const ValueType beta_delta_energy) -> ValueType {
+      if (beta_delta_energy <= 0) {
+         return 1;
+      }
+      if (fast_acceptance) {
+         return beta_delta_energy < utility::FAST_EXP_CUTOFF<ValueType> ? utility::fast_exp(-beta_delta_energy) : 0;
+      }
+      return std::exp(-beta_delta_energy);
+   };
+   
+   // A rejection-free flip updates the rates of the neighbors as well
+   std::size_t num_neighbors = 0;
+   for (const auto &neighbors: neighbor_list) {
+      num_neighbors += neighbors.size();
+   }
+   const double flip_cost = 1 + static_cast<double>(num_neighbors)/system_size;
+   
+   utility::UniformRealDistribution<double> dist_real;
+   std::vector<ValueType> rate_list(system_size);
+   utility::FenwickTree<ValueType> rate_tree(system_size);
+   ValueType beta_ref = 0;
+   bool rebuild = true;
+   std::int32_t num_flips = system_size;
+   
+   for (std::int32_t sweep_count = 0; sweep_count < num_sweeps; sweep_count++) {
+      if (is_finished && is_finished()) {
+         return;
+      }
+      const auto beta = beta_list[sweep_count];
+      if (num_flips*flip_cost >= system_size) {
+         // Sequential Metropolis sweep
+         num_flips = 0;
+         for (std::int32_t i = 0; i < system_size; i++) {
+            const auto delta_energy = system->GetEnergyDifference(i);
+            const bool accept = fast_acceptance ?
+            utility::metropolis_accept<true>(beta, delta_energy, dist_real, random_number_engine) :
+            utility::metropolis_accept<false>(beta, delta_energy, dist_real, random_number_engine);
+            if (accept) {
+               system->Flip(i);
+               num_flips++;
+            }
+         }
+         rebuild = true;
+         continue;
+      }
+      
+      if (rebuild || beta < beta_ref) {
+         beta_ref = beta;
+         for (std::int32_t i = 0; i < system_size; i++) {
+            rate_list[i] = boltzmann_factor(beta_ref*system->GetEnergyDifference(i));
+         }
+         rate_tree.assign(rate_list);
+      }
+      
+      double remaining_proposals = system_size;
+      std::int32_t num_thinned = 0;
+      num_flips = 0;
+      while (true) {
+         const double total_rate = rate_tree.total();
+         if (total_rate <= 0) {
+            break;
+         }
+         // Number of proposals up to and including the next candidate
+         const double p = total_rate/system_size;
+         double num_proposals = 1;
+         if (p < 1) {
+            num_proposals += std::floor(std::log(1 - dist_real(random_number_engine))/std::log1p(-p));
+         }
+         if (num_proposals > remaining_proposals) {
+            break;
+         }
+         remaining_proposals -= num_proposals;
+         
+         const std::int32_t index = static_cast<std::int32_t>(rate_tree.find(static_cast<ValueType>(dist_real(random_number_engine)*total_rate)));
+         if (beta > beta_ref) {
+            const ValueType delta_energy = system->GetEnergyDifference(index);
+            if (delta_energy > 0 && !(boltzmann_factor((beta - beta_ref)*delta_energy) > dist_real(random_number_engine))) {
+               num_thinned++;
+               continue;
+            }
+         }
+         system->Flip(index);
+         num_flips++;
+         rate_tree.set(index, boltzmann_factor(beta_ref*system->GetEnergyDifference(index)));
+         for (const auto &v_index: neighbor_list[index]) {
+            rate_tree.set(v_index, boltzmann_factor(beta_ref*system->GetEnergyDifference(v_index)));
+         }
+      }
+      
+      // Rebuilding costs about system_size evaluations, while each thinned candidate costs about log(system_size)
+      rebuild = num_thinned*8 > system_size;
+   }
+}
+
+//! @brief Single flip updater for the polynomial SA systems, which draws the random numbers from the given engine.
+//! If is_finished is given, it is called before each sweep and the remaining sweeps are skipped once it returns true.
 template<class SystemType, typename RandType>
 void SingleFlipUpdater(SystemType *system,
                        const std::int32_t num_sweeps,
                        const std::vector<typename SystemType::ValueType> &beta_list,
-                       const typename RandType::result_type seed,
-                       const algorithm::UpdateMethod update_metod) {
+                       RandType &random_number_engine,
+                       const algorithm::UpdateMethod update_metod,
+                       const bool fast_acceptance = false,
+                       const std::function<bool()> &is_finished = nullptr) {
    
    const std::int32_t system_size = system->GetSystemSize();
-   
-   // Set random number engine
-   RandType random_number_engine(seed);
-   std::uniform_real_distribution<typename SystemType::ValueType> dist_real(0, 1);
+   utility::UniformRealDistribution<typename SystemType::ValueType> dist_real;
    
    if (update_metod == algorithm::UpdateMethod::METROPOLIS) {
       // Do sequential update
       for (std::int32_t sweep_count = 0; sweep_count < num_sweeps; sweep_count++) {
+         if (is_finished && is_finished()) {
+            return;
+         }
          const auto beta = beta_list[sweep_count];
          for (std::int32_t i = 0; i < system_size; i++) {
             const auto delta_energy = system->GetEnergyDifference(i);
-            if (delta_energy <= 0 || std::exp(-beta*delta_energy) > dist_real(random_number_engine)) {
+            const bool accept = fast_acceptance ?
+            utility::metropolis_accept<true>(beta, delta_energy, dist_real, random_number_engine) :
+            utility::metropolis_accept<false>(beta, delta_energy, dist_real, random_number_engine);
+            if (accept) {
                system->Flip(i);
             }
          }
@@ -365,15 +1063,176 @@ void SingleFlipUpdater(SystemType *system,
    else if (update_metod == algorithm::UpdateMethod::HEAT_BATH) {
       // Do sequential update
       for (std::int32_t sweep_count = 0; sweep_count < num_sweeps; sweep_count++) {
+         if (is_finished && is_finished()) {
+            return;
+         }
          const auto beta = beta_list[sweep_count];
          for (std::int32_t i = 0; i < system_size; i++) {
             const auto delta_energy = system->GetEnergyDifference(i);
-            if (1/(1 + std::exp(beta*delta_energy)) > dist_real(random_number_engine)) {
+            const bool accept = fast_acceptance ?
+            utility::heat_bath_accept<true>(beta*delta_energy, dist_real, random_number_engine) :
+            utility::heat_bath_accept<false>(beta*delta_energy, dist_real, random_number_engine);
+            if (accept) {
                system->Flip(i);
             }
          }
       }
    }
+   else if (update_metod == algorithm::UpdateMethod::REJECTION_FREE) {
+      RejectionFreeSingleFlipUpdater(system, num_sweeps, beta_list, random_number_engine, fast_acceptance, is_finished);
+   }
+   else {
+      throw std::runtime_error("Unknown UpdateMethod");
+   }
+}
+
+//! @brief Single flip updater for the polynomial SA systems.
+//! If is_finished is given, it is called before each sweep and the remaining sweeps are skipped once it returns true.
+template<class SystemType, typename RandType>
+void SingleFlipUpdater(SystemType *system,
+                       const std::int32_t num_sweeps,
+                       const std::vector<typename SystemType::ValueType> &beta_list,
+                       const typename RandType::result_type seed,
+                       const algorithm::UpdateMethod update_metod,
+                       const bool fast_acceptance = false,
+                       const std::function<bool()> &is_finished = nullptr) {
+   
+   // Set random number engine
+   RandType random_number_engine(seed);
+   SingleFlipUpdater(system, num_sweeps, beta_list, random_number_engine, update_metod, fast_acceptance, is_finished);
+}
+
+//! @brief Single flip updater for the polynomial SA systems, which updates the variables of each color at the same time.
+//! Since the variables of the same color share no interaction, the decisions for them do not depend on each other,
+//! which keeps detailed balance of the sequential update in the order of the colors.
+//! The random numbers of a color are drawn in order, and then the variables are decided and flipped by num_threads threads,
+//! which add to the energy differences of the shared neighbors atomically.
+//! The result depends on the number of threads only through the rounding order of these additions.
+//! @param color_list The variables of each color, given by utility::GreedyColoring(GenerateNeighborList(*system)).
+template<class SystemType, typename RandType>
+void ColoredSingleFlipUpdater(SystemType *system,
+                              const std::int32_t num_sweeps,
+                              const std::vector<typename SystemType::ValueType> &beta_list,
+                              const typename RandType::result_type seed,
+                              const algorithm::UpdateMethod update_metod,
+                              const bool fast_acceptance,
+                              const std::vector<std::vector<std::int32_t>> &color_list,
+                              const std::int32_t num_threads,
+                              const std::function<bool()> &is_finished = nullptr) {
+   
+   using ValueType = typename SystemType::ValueType;
+   if (update_metod != algorithm::UpdateMethod::METROPOLIS && update_metod != algorithm::UpdateMethod::HEAT_BATH) {
+      throw std::runtime_error("The update with graph coloring supports only METROPOLIS and HEAT_BATH.");
+   }
+   const bool is_metropolis = update_metod == algorithm::UpdateMethod::METROPOLIS;
+   
+   // Set random number engine
+   RandType random_number_engine(seed);
+   utility::UniformRealDistribution<ValueType> dist_real;
+   
+   std::size_t max_color_size = 0;
+   for (const auto &color: color_list) {
+      max_color_size = std::max(max_color_size, color.size());
+   }
+   std::vector<ValueType> uniform_list(max_color_size);
+   
+   for (std::int32_t sweep_count = 0; sweep_count < num_sweeps; sweep_count++) {
+      if (is_finished && is_finished()) {
+         return;
+      }
+      const ValueType beta = beta_list[sweep_count];
+      for (const auto &color: color_list) {
+         const std::int64_t color_size = static_cast<std::int64_t>(color.size());
+         dist_real.fill(random_number_engine, uniform_list.data(), color.size());
+         
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+         for (std::int64_t k = 0; k < color_size; ++k) {
+            const ValueType delta_energy = system->GetEnergyDifference(color[k]);
+            bool accept = false;
+            if (is_metropolis) {
+               accept = fast_acceptance ?
+               utility::metropolis_accept<true>(beta, delta_energy, uniform_list[k]) :
+               utility::metropolis_accept<false>(beta, delta_energy, uniform_list[k]);
+            }
+            else {
+               accept = fast_acceptance ?
+               utility::heat_bath_accept<true>(beta*delta_energy, uniform_list[k]) :
+               utility::heat_bath_accept<false>(beta*delta_energy, uniform_list[k]);
+            }
+            if (accept && num_threads == 1) {
+               system->Flip(color[k]);
+            }
+            else if (accept) {
+               system->FlipAtomic(color[k]);
+            }
+         }
+      }
+   }
+}
+
+//! @brief Single flip updater for the replica-packed systems.
+//! The flips of all the replicas for a variable are decided at once and applied as a bit mask.
+template<class SystemType, typename RandType>
+void ReplicaPackedSingleFlipUpdater(SystemType *system,
+                                    const std::int32_t num_sweeps,
+                                    const std::vector<typename SystemType::ValueType> &beta_list,
+                                    const typename RandType::result_type seed,
+                                    const algorithm::UpdateMethod update_metod,
+                                    const bool fast_acceptance = false,
+                                    const std::function<bool()> &is_finished = nullptr) {
+
+   using WordType = typename SystemType::WordType;
+   const std::int32_t system_size = system->GetSystemSize();
+   const std::int32_t num_replicas = system->GetNumReplicas();
+
+   // Set random number engine
+   RandType random_number_engine(seed);
+   utility::UniformRealDistribution<typename SystemType::ValueType> dist_real;
+
+   if (update_metod == algorithm::UpdateMethod::METROPOLIS) {
+      // Do sequential update
+      for (std::int32_t sweep_count = 0; sweep_count < num_sweeps; sweep_count++) {
+         if (is_finished && is_finished()) {
+            return;
+         }
+         const auto beta = beta_list[sweep_count];
+         for (std::int32_t i = 0; i < system_size; i++) {
+            const auto &delta_energy = system->GetEnergyDifference(i);
+            WordType mask = 0;
+            for (std::int32_t r = 0; r < num_replicas; ++r) {
+               const bool accept = fast_acceptance ?
+               utility::metropolis_accept<true>(beta, delta_energy[r], dist_real, random_number_engine) :
+               utility::metropolis_accept<false>(beta, delta_energy[r], dist_real, random_number_engine);
+               if (accept) {
+                  mask |= WordType(1) << r;
+               }
+            }
+            system->Flip(i, mask);
+         }
+      }
+   }
+   else if (update_metod == algorithm::UpdateMethod::HEAT_BATH) {
+      // Do sequential update
+      for (std::int32_t sweep_count = 0; sweep_count < num_sweeps; sweep_count++) {
+         if (is_finished && is_finished()) {
+            return;
+         }
+         const auto beta = beta_list[sweep_count];
+         for (std::int32_t i = 0; i < system_size; i++) {
+            const auto &delta_energy = system->GetEnergyDifference(i);
+            WordType mask = 0;
+            for (std::int32_t r = 0; r < num_replicas; ++r) {
+               const bool accept = fast_acceptance ?
+               utility::heat_bath_accept<true>(beta*delta_energy[r], dist_real, random_number_engine) :
+               utility::heat_bath_accept<false>(beta*delta_energy[r], dist_real, random_number_engine);
+               if (accept) {
+                  mask |= WordType(1) << r;
+               }
+            }
+            system->Flip(i, mask);
+         }
+      }
+   }
    else {
       throw std::runtime_error("Unknown UpdateMethod");
    }
@@ -16,14 +16,19 @@
 
 #include <algorithm>
 #include <cmath>
-#include <random>
-#include <unordered_map>
+#include <cstdint>
+#include <vector>
 
 #include "openjij/graph/graph.hpp"
 #include "openjij/system/classical_ising.hpp"
+#include "openjij/utility/random.hpp"
 #include "openjij/utility/schedule_list.hpp"
 #include "openjij/utility/union_find.hpp"
 
+#ifdef USE_OMP
+#include <omp.h>
+#endif
+
 namespace openjij {
 namespace updater {
 
@@ -35,34 +40,89 @@ namespace updater {
 template <typename System> struct SwendsenWang;
 
 /**
- * @brief swendsen wang updater for classical ising model (on Sparse graph)
+ * @brief swendsen wang updater for classical ising model on sparse graphs,
+ * which labels the clusters with flat arrays instead of a hash map. The bonds
+ * of each row, the labels and the flips are processed in parallel by OpenMP
+ * threads. The random numbers are taken from utility::Philox4x32 streams
+ * indexed by the node, so that the result does not depend on the number of
+ * threads.
  *
- * @tparam FloatType
+ * @tparam System type of system (ClassicalIsing with Sparse or CSRSparse)
  */
-template <typename FloatType>
-struct SwendsenWang<system::ClassicalIsing<graph::Sparse<FloatType>>> {
+template <typename System> struct SparseSwendsenWang {
+  using FloatType = typename System::VectorXx::Scalar;
 
-  using ClIsing = system::ClassicalIsing<graph::Sparse<FloatType>>;
+  /**
+   * @brief the number of spins from which the sweep uses OpenMP threads
+   */
+  static constexpr std::int64_t PARALLEL_THRESHOLD = 4096;
 
   template <typename RandomNumberEngine>
   inline static void
-  update(ClIsing &system, RandomNumberEngine &random_number_engine,
+  update(System &system, RandomNumberEngine &random_number_engine,
          const utility::ClassicalUpdaterParameter &parameter) {
-    auto urd = std::uniform_real_distribution<>(0, 1.0);
-
     // num_spin = system size + additional spin
-    const size_t num_spin = system.spin.size();
+    const std::int64_t num_spin = static_cast<std::int64_t>(system.spin.size());
+
+    // the storage is kept over the sweeps of the calling thread, and is
+    // shared with the threads of the sweep through the references
+    thread_local utility::ConcurrentUnionFind union_find_storage;
+    thread_local std::vector<std::int8_t> cluster_sign_storage;
+    auto &union_find_tree = union_find_storage;
+    auto &cluster_sign = cluster_sign_storage;
+    union_find_tree.reset(num_spin);
+    cluster_sign.resize(num_spin);
+
+    const std::uint64_t bond_key = random_number_engine();
+    const std::uint64_t flip_key = random_number_engine();
+
+    // small systems do not pay for the fork of the threads, and the reads
+    // run in parallel (e.g. by the batch sampling) do not fork again. the
+    // region of a single thread still binds the loops of the sweep, which
+    // would otherwise be shared by the team of the enclosing region
+    bool parallel = num_spin >= PARALLEL_THRESHOLD;
+#ifdef USE_OMP
+    parallel = parallel && !omp_in_parallel();
+#endif
+#pragma omp parallel if (parallel)
+    sweep(system, union_find_tree, cluster_sign, bond_key, flip_key,
+          parameter.beta);
+
+    // 4. recompute dE and energy, whose changes involve every bond between
+    // the flipped and the other clusters
+    system.reset_dE();
+  }
+
+  /**
+   * @brief make the clusters and flip them, where the loops are shared by
+   * the threads of the parallel region opened by update
+   *
+   * @param system object of a classical ising system
+   * @param union_find_tree union-find tree of system.spin.size() nodes
+   * @param cluster_sign sign multiplied to the spins of each cluster, which
+   * is indexed by the root
+   * @param bond_key key of the random numbers for the bonds
+   * @param flip_key key of the random numbers for the clusters
+   * @param beta inverse temperature
+   */
+  static void sweep(System &system, utility::ConcurrentUnionFind &union_find_tree,
+                    std::vector<std::int8_t> &cluster_sign,
+                    const std::uint64_t bond_key, const std::uint64_t flip_key,
+                    const double beta) {
+    const std::int64_t num_spin = static_cast<std::int64_t>(system.spin.size());
 
     // 1. update bonds
-    auto union_find_tree = utility::UnionFind(num_spin);
-    for (std::size_t node = 0; node < num_spin; ++node) {
-      for (typename ClIsing::SparseMatrixXx::InnerIterator it(
+#pragma omp for schedule(static)
+    for (std::int64_t node = 0; node < num_spin; ++node) {
+      auto engine = utility::Philox4x32(bond_key, node);
+      auto urd = utility::UniformRealDistribution<double>();
+      for (typename System::SparseMatrixXx::InnerIterator it(
                system.interaction, node);
            it; ++it) {
         // fetch adjacent node
-        std::size_t adj_node = it.index();
+        const std::int64_t adj_node = it.index();
         // fetch system.interaction(node, adj_node)
-        const FloatType &J = it.value();
+        const FloatType J = it.value();
         if (node >= adj_node)
           continue;
         // check if bond can be connected
@@ -71,112 +131,53 @@ struct SwendsenWang<system::ClassicalIsing<graph::Sparse<FloatType>>> {
         const auto unite_rate =
             std::max(static_cast<FloatType>(0.0),
                      static_cast<FloatType>(
-                         1.0 - std::exp(-2.0 * parameter.beta * std::abs(J))));
-        if (urd(random_number_engine) < unite_rate)
+                         1.0 - std::exp(-2.0 * beta * std::abs(J))));
+        if (urd(engine) < unite_rate)
           union_find_tree.unite_sets(node, adj_node);
       }
     }
 
-    // 2. make clusters
-    const auto cluster_map = [num_spin, &union_find_tree]() {
-      auto cluster_map = std::unordered_multimap<utility::UnionFind::Node,
-                                                 utility::UnionFind::Node>();
-      for (std::size_t node = 0; node < num_spin; ++node) {
-        cluster_map.insert({union_find_tree.find_set(node), node});
-      }
-      return cluster_map;
-    }();
-
-    // 3. update spin states in each cluster
-    for (auto &&c : union_find_tree.get_roots()) {
-      const auto range = cluster_map.equal_range(c);
-
-      // 3.1. decide spin state (flip with the probability 1/2)
-      const FloatType probability = 1.0 / 2.0;
-      if (urd(random_number_engine) < probability) {
-        // 3.2. update spin states
-        for (auto itr = range.first, last = range.second; itr != last; ++itr) {
-          const auto idx = itr->second;
-          system.spin(idx) *= -1;
-        }
+    // 2. decide spin state of each cluster at its root, the smallest node
+    // (flip with the probability 1/2)
+#pragma omp for schedule(static)
+    for (std::int64_t node = 0; node < num_spin; ++node) {
+      if (union_find_tree.find_set(node) ==
+          static_cast<utility::ConcurrentUnionFind::Node>(node)) {
+        cluster_sign[node] =
+            (utility::Philox4x32(flip_key, node)() >> 63) ? -1 : 1;
       }
     }
 
-    return;
+    // 3. update spin states in each cluster, where all the spins are flipped
+    // together with the cluster of the dummy spin so that it stays +1
+    const std::int8_t dummy_sign =
+        cluster_sign[union_find_tree.find_set(num_spin - 1)];
+#pragma omp for schedule(static)
+    for (std::int64_t node = 0; node < num_spin; ++node) {
+      system.spin(node) *=
+          cluster_sign[union_find_tree.find_set(node)] * dummy_sign;
+    }
   }
 };
 
 /**
- * @brief swendsen wang updater for classical ising model (on CSR Sparse graph)
+ * @brief swendsen wang updater for classical ising model (on Sparse graph)
  *
  * @tparam FloatType
  */
 template <typename FloatType>
-struct SwendsenWang<system::ClassicalIsing<graph::CSRSparse<FloatType>>> {
-  //TODO: duplicate code of `SwendsenWang<system::ClassicalIsing<graph::Sparse<FloatType>>>`, need fix.
-
-  using ClIsing = system::ClassicalIsing<graph::CSRSparse<FloatType>>;
+struct SwendsenWang<system::ClassicalIsing<graph::Sparse<FloatType>>>
+    : public SparseSwendsenWang<
+          system::ClassicalIsing<graph::Sparse<FloatType>>> {};
 
-  template <typename RandomNumberEngine>
-  inline static void
-  update(ClIsing &system, RandomNumberEngine &random_number_engine,
-         const utility::ClassicalUpdaterParameter &parameter) {
-    auto urd = std::uniform_real_distribution<>(0, 1.0);
-
-    // num_spin = system size + additional spin
-    const size_t num_spin = system.spin.size();
-
-    // 1. update bonds
-    auto union_find_tree = utility::UnionFind(num_spin);
-    for (std::size_t node = 0; node < num_spin; ++node) {
-      for (typename ClIsing::SparseMatrixXx::InnerIterator it(
-               system.interaction, node);
-           it; ++it) {
-        // fetch adjacent node
-        std::size_t adj_node = it.index();
-        // fetch system.interaction(node, adj_node)
-        const FloatType &J = it.value();
-        if (node >= adj_node)
-          continue;
-        // check if bond can be connected
-        if (J * system.spin(node) * system.spin(adj_node) > 0)
-          continue;
-        const auto unite_rate =
-            std::max(static_cast<FloatType>(0.0),
-                     static_cast<FloatType>(
-                         1.0 - std::exp(-2.0 * parameter.beta * std::abs(J))));
-        if (urd(random_number_engine) < unite_rate)
-          union_find_tree.unite_sets(node, adj_node);
-      }
-    }
-
-    // 2. make clusters
-    const auto cluster_map = [num_spin, &union_find_tree]() {
-      auto cluster_map = std::unordered_multimap<utility::UnionFind::Node,
-                                                 utility::UnionFind::Node>();
-      for (std::size_t node = 0; node < num_spin; ++node) {
-        cluster_map.insert({union_find_tree.find_set(node), node});
-      }
-      return cluster_map;
-    }();
-
-    // 3. update spin states in each cluster
-    for (auto &&c : union_find_tree.get_roots()) {
-      const auto range = cluster_map.equal_range(c);
-
-      // 3.1. decide spin state (flip with the probability 1/2)
-      const FloatType probability = 1.0 / 2.0;
-      if (urd(random_number_engine) < probability) {
-        // 3.2. update spin states
-        for (auto itr = range.first, last = range.second; itr != last; ++itr) {
-          const auto idx = itr->second;
-          system.spin(idx) *= -1;
-        }
-      }
-    }
-
-    return;
-  }
-};
+/**
+ * @brief swendsen wang updater for classical ising model (on CSR Sparse graph)
+ *
+ * @tparam FloatType
+ */
+template <typename FloatType>
+struct SwendsenWang<system::ClassicalIsing<graph::CSRSparse<FloatType>>>
+    : public SparseSwendsenWang<
+          system::ClassicalIsing<graph::CSRSparse<FloatType>>> {};
 } // namespace updater
 } // namespace openjij
@@ -0,0 +1,171 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "openjij/graph/graph.hpp"
+#include "openjij/system/classical_ising.hpp"
+#include "openjij/updater/single_spin_flip.hpp"
+#include "openjij/utility/random.hpp"
+#include "openjij/utility/schedule_list.hpp"
+
+namespace openjij {
+namespace updater {
+
+/**
+ * @brief wolff updater
+ *
+ * @tparam System
+ */
+template <typename System> struct Wolff;
+
+/**
+ * @brief wolff single-cluster updater for classical ising model on sparse
+ * graphs. A cluster is grown from a random seed spin through the satisfied
+ * bonds and flipped, until as many spins as the system size have been
+ * flipped. The growth uses a stack and a visited array marked with the epoch
+ * of the cluster, both of which are kept over the updates, so that the cost
+ * of a cluster is proportional to its size rather than the system size.
+ * A cluster which reaches the dummy spin of the local fields is flipped
+ * together with it, and the sign of the dummy spin is restored by a single
+ * global flip at the end of the update.
+ *
+ * @tparam System type of system (ClassicalIsing with Sparse or CSRSparse)
+ */
+template <typename System> struct SparseWolff {
+  using FloatType = typename System::VectorXx::Scalar;
+
+  template <typename RandomNumberEngine>
+  inline static void
+  update(System &system, RandomNumberEngine &random_number_engine,
+         const utility::ClassicalUpdaterParameter &parameter) {
+    const std::size_t num_spins = system.num_spins;
+    if (num_spins == 0) {
+      return;
+    }
+
+    // the storage is kept over the updates of the calling thread
+    thread_local std::vector<std::uint32_t> visited;
+    thread_local std::vector<std::size_t> stack;
+    thread_local std::vector<std::size_t> cluster;
+    thread_local std::vector<std::int8_t> spin_sign_storage;
+    thread_local std::uint32_t epoch = 0;
+    if (visited.size() != num_spins + 1) {
+      visited.assign(num_spins + 1, 0);
+      epoch = 0;
+    }
+
+    auto urd = utility::UniformRealDistribution<double>();
+    auto uid = std::uniform_int_distribution<std::size_t>(0, num_spins - 1);
+
+    const auto &interaction = system.interaction;
+    const auto *outer = interaction.outerIndexPtr();
+    const auto *inner = interaction.innerIndexPtr();
+    const auto *inner_nonzeros = interaction.innerNonZeroPtr();
+    const FloatType *value = interaction.valuePtr();
+
+    // assure that the dummy spin is not changed.
+    system.spin(num_spins) = 1;
+    SparseSingleSpinFlip<System>::load_spin_sign(system, spin_sign_storage);
+    std::int8_t *spin_sign = spin_sign_storage.data();
+    // dE of the dummy spin contains its diagonal element, which is not a part
+    // of the energy
+    const FloatType dummy_diagonal = interaction.coeff(num_spins, num_spins);
+
+    // the number of the flipped spins except for the dummy spin
+    std::size_t num_flipped = 0;
+    while (num_flipped < num_spins) {
+      if (++epoch == 0) {
+        std::fill(visited.begin(), visited.end(), 0);
+        epoch = 1;
+      }
+
+      // 1. grow a cluster from a random seed
+      const std::size_t seed = uid(random_number_engine);
+      visited[seed] = epoch;
+      stack.assign(1, seed);
+      cluster.clear();
+      while (!stack.empty()) {
+        const std::size_t node = stack.back();
+        stack.pop_back();
+        cluster.push_back(node);
+
+        const auto begin = outer[node];
+        const auto end = inner_nonzeros == nullptr
+                             ? outer[node + 1]
+                             : outer[node] + inner_nonzeros[node];
+        for (auto k = begin; k < end; ++k) {
+          const std::size_t adj_node = inner[k];
+          if (visited[adj_node] == epoch)
+            continue;
+          // only the satisfied bonds can be connected
+          const FloatType J = value[k];
+          if (J * spin_sign[node] * spin_sign[adj_node] >= 0)
+            continue;
+          const auto unite_rate =
+              1.0 - std::exp(-2.0 * parameter.beta * std::abs(J));
+          if (urd(random_number_engine) < unite_rate) {
+            visited[adj_node] = epoch;
+            stack.push_back(adj_node);
+          }
+        }
+      }
+      num_flipped += cluster.size() - (visited[num_spins] == epoch ? 1 : 0);
+
+      // 2. flip the cluster, which updates the energy and dE of its
+      // neighbors. The dummy spin may be flipped here as well, since the
+      // bonds depend only on the relative signs of the spins.
+      for (const std::size_t node : cluster) {
+        SparseSingleSpinFlip<System>::flip(system, spin_sign, node);
+      }
+      if (visited[num_spins] == epoch) {
+        system.energy += 2 * dummy_diagonal;
+      }
+    }
+
+    // 3. bring the dummy spin back to +1 by flipping all the spins, which
+    // keeps the energy and dE unchanged
+    if (spin_sign[num_spins] < 0) {
+      system.spin = -system.spin;
+    }
+  }
+};
+
+/**
+ * @brief wolff updater for classical ising model (on Sparse graph)
+ *
+ * @tparam FloatType
+ */
+template <typename FloatType>
+struct Wolff<system::ClassicalIsing<graph::Sparse<FloatType>>>
+    : public SparseWolff<system::ClassicalIsing<graph::Sparse<FloatType>>> {};
+
+/**
+ * @brief wolff updater for classical ising model (on CSR Sparse graph)
+ *
+ * @tparam FloatType
+ */
+template <typename FloatType>
+struct Wolff<system::ClassicalIsing<graph::CSRSparse<FloatType>>>
+    : public SparseWolff<
+          system::ClassicalIsing<graph::CSRSparse<FloatType>>> {};
+} // namespace updater
+} // namespace openjij
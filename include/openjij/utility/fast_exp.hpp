@@ -0,0 +1,162 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPENJIJ_USE_FMATH
+#include "openjij/utility/fmath/fmath.hpp"
+#endif
+
+namespace openjij {
+namespace utility {
+
+/**
+ * @brief \f$ x \f$ above which \f$ e^{-x} \f$ is treated as zero in the fast
+ * acceptance test. The error is below the resolution of the uniform random
+ * numbers, \f$ e^{-40} \simeq 4\times 10^{-18} \f$.
+ */
+template <typename FloatType> constexpr FloatType FAST_EXP_CUTOFF = 40;
+
+/**
+ * @brief exponential function with the vendored fmath library (falls back to
+ * std::exp where SSE2 is not available)
+ *
+ * @param x exponent
+ *
+ * @return \f$ e^x \f$
+ */
+inline double fast_exp(const double x) {
+#ifdef OPENJIJ_USE_FMATH
+  return fmath::expd(x);
+#else
+  return std::exp(x);
+#endif
+}
+
+/**
+ * @brief Metropolis acceptance test \f$ u < e^{-\beta\Delta E} \f$. Moves
+ * with \f$ \Delta E \le 0 \f$ are accepted without drawing a random number,
+ * and the others always draw one in the default mode (also at \f$ \beta = 0
+ * \f$), which is the same random stream as the plain std::exp test.
+ *
+ * @tparam fast_acceptance if true, fast_exp is used and the random number is
+ * not drawn when \f$ \beta\Delta E \f$ exceeds FAST_EXP_CUTOFF
+ * @param beta inverse temperature \f$ \beta \f$
+ * @param delta_energy energy difference \f$ \Delta E \f$
+ * @param dist uniform real distribution on [0, 1)
+ * @param random_number_engine random number engine
+ *
+ * @return true if the move is accepted
+ */
+template <bool fast_acceptance, typename BetaType, typename FloatType,
+          typename Distribution, typename RandomNumberEngine>
+inline bool metropolis_accept(const BetaType beta,
+                              const FloatType delta_energy,
+                              Distribution &dist,
+                              RandomNumberEngine &random_number_engine) {
+  if (delta_energy <= 0) {
+    return true;
+  }
+  const auto beta_delta_energy = beta * delta_energy;
+  if (fast_acceptance) {
+    return beta_delta_energy < FAST_EXP_CUTOFF<decltype(beta_delta_energy)> &&
+           fast_exp(-beta_delta_energy) > dist(random_number_engine);
+  }
+  return std::exp(-beta_delta_energy) > dist(random_number_engine);
+}
+
+/**
+ * @brief heat bath acceptance test \f$ u < 1/(1 + e^{\beta\Delta E}) \f$
+ *
+ * @tparam fast_acceptance if true, fast_exp is used and the random number is
+ * not drawn when \f$ |\beta\Delta E| \f$ exceeds FAST_EXP_CUTOFF
+ * @param beta_delta_energy \f$ \beta\Delta E \f$
+ * @param dist uniform real distribution on [0, 1)
+ * @param random_number_engine random number engine
+ *
+ * @return true if the move is accepted
+ */
+template <bool fast_acceptance, typename FloatType, typename Distribution,
+          typename RandomNumberEngine>
+inline bool heat_bath_accept(const FloatType beta_delta_energy,
+                             Distribution &dist,
+                             RandomNumberEngine &random_number_engine) {
+  if (fast_acceptance) {
+    if (beta_delta_energy > FAST_EXP_CUTOFF<FloatType>) {
+      return false;
+    }
+    if (beta_delta_energy < -FAST_EXP_CUTOFF<FloatType>) {
+      return true;
+    }
+    return 1 / (1 + fast_exp(beta_delta_energy)) > dist(random_number_engine);
+  }
+  return 1 / (1 + std::exp(beta_delta_energy)) > dist(random_number_engine);
+}
+
+/**
+ * @brief Metropolis acceptance test with a uniform random number drawn in
+ * advance, which is drawn regardless of \f$ \beta\Delta E \f$
+ *
+ * @tparam fast_acceptance if true, fast_exp is used
+ * @param beta inverse temperature \f$ \beta \f$
+ * @param delta_energy energy difference \f$ \Delta E \f$
+ * @param uniform uniform random number on [0, 1)
+ *
+ * @return true if the move is accepted
+ */
+template <bool fast_acceptance, typename BetaType, typename FloatType>
+inline bool metropolis_accept(const BetaType beta,
+                              const FloatType delta_energy,
+                              const double uniform) {
+  if (delta_energy <= 0) {
+    return true;
+  }
+  const auto beta_delta_energy = beta * delta_energy;
+  if (fast_acceptance) {
+    return beta_delta_energy < FAST_EXP_CUTOFF<decltype(beta_delta_energy)> &&
+           fast_exp(-beta_delta_energy) > uniform;
+  }
+  return std::exp(-beta_delta_energy) > uniform;
+}
+
+/**
+ * @brief heat bath acceptance test with a uniform random number drawn in
+ * advance
+ *
+ * @tparam fast_acceptance if true, fast_exp is used
+ * @param beta_delta_energy \f$ \beta\Delta E \f$
+ * @param uniform uniform random number on [0, 1)
+ *
+ * @return true if the move is accepted
+ */
+template <bool fast_acceptance, typename FloatType>
+inline bool heat_bath_accept(const FloatType beta_delta_energy,
+                             const FloatType uniform) {
+  if (fast_acceptance) {
+    if (beta_delta_energy > FAST_EXP_CUTOFF<FloatType>) {
+      return false;
+    }
+    if (beta_delta_energy < -FAST_EXP_CUTOFF<FloatType>) {
+      return true;
+    }
+    return 1 / (1 + fast_exp(beta_delta_energy)) > uniform;
+  }
+  return 1 / (1 + std::exp(beta_delta_energy)) > uniform;
+}
+
+} // namespace utility
+} // namespace openjij
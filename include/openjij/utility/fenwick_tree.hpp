@@ -0,0 +1,131 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace openjij {
+namespace utility {
+
+/**
+ * @brief binary indexed tree over non-negative weights, which supports the
+ * update of a weight and the sampling of an index proportional to its weight
+ * in \f$ O(\log N) \f$
+ *
+ * @tparam FloatType floating-point type of weights
+ */
+template <typename FloatType> class FenwickTree {
+public:
+  using size_type = std::size_t;
+
+  explicit FenwickTree(size_type n) : _weight(n, 0), _tree(n + 1, 0) {
+    _top_bit = 1;
+    while (_top_bit * 2 <= n) {
+      _top_bit *= 2;
+    }
+  }
+
+  size_type size() const { return _weight.size(); }
+
+  FloatType get(size_type index) const { return _weight[index]; }
+
+  /**
+   * @brief sum of all the weights
+   */
+  FloatType total() const { return _total; }
+
+  /**
+   * @brief set the weight of index
+   *
+   * @param index index
+   * @param weight new weight
+   */
+  void set(size_type index, FloatType weight) {
+    const FloatType delta = weight - _weight[index];
+    _weight[index] = weight;
+    _total += delta;
+    for (size_type i = index + 1; i < _tree.size(); i += i & (~i + 1)) {
+      _tree[i] += delta;
+    }
+  }
+
+  /**
+   * @brief replace all the weights in \f$ O(N) \f$
+   *
+   * @param weight new weights, whose size must be equal to the size of the tree
+   */
+  void assign(const std::vector<FloatType> &weight) {
+    _weight = weight;
+    rebuild();
+  }
+
+  /**
+   * @brief recompute the partial sums from the weights in \f$ O(N) \f$,
+   * which discards the rounding errors accumulated by set
+   */
+  void rebuild() {
+    std::fill(_tree.begin(), _tree.end(), 0);
+    _total = 0;
+    for (size_type i = 1; i < _tree.size(); ++i) {
+      _tree[i] += _weight[i - 1];
+      _total += _weight[i - 1];
+      const size_type parent = i + (i & (~i + 1));
+      if (parent < _tree.size()) {
+        _tree[parent] += _tree[i];
+      }
+    }
+  }
+
+  /**
+   * @brief find the index whose cumulative weight range contains value
+   *
+   * @param value value in \f$ [0, \mathrm{total}) \f$
+   *
+   * @return the smallest index such that the sum of the weights up to index
+   * exceeds value. Indices with zero weight are never returned as long as
+   * value is in range.
+   */
+  size_type find(FloatType value) const {
+    size_type position = 0;
+    for (size_type bit = _top_bit; bit != 0; bit >>= 1) {
+      const size_type next = position + bit;
+      if (next < _tree.size() && _tree[next] <= value) {
+        position = next;
+        value -= _tree[next];
+      }
+    }
+    // value may reach the total due to rounding errors, in which case the
+    // last index with a positive weight is returned
+    if (position >= _weight.size()) {
+      position = _weight.size() - 1;
+      while (position > 0 && _weight[position] <= 0) {
+        --position;
+      }
+    }
+    return position;
+  }
+
+private:
+  std::vector<FloatType> _weight;
+  std::vector<FloatType> _tree;
+  FloatType _total = 0;
+  size_type _top_bit;
+};
+
+} // namespace utility
+} // namespace openjij
@@ -0,0 +1,79 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace openjij {
+namespace utility {
+
+/**
+ * @brief greedy coloring of a graph, which visits the vertices in the order of
+ * decreasing degree (Welsh-Powell) and gives each of them the smallest color
+ * not used by its neighbors. Variables of the same color do not interact with
+ * each other, so that they can be updated at the same time.
+ *
+ * @tparam IndexType type of vertex indices
+ * @param neighbor_list neighbors of each vertex, which must be symmetric
+ *
+ * @return vertices of each color in increasing order
+ */
+template <typename IndexType>
+std::vector<std::vector<IndexType>>
+GreedyColoring(const std::vector<std::vector<IndexType>> &neighbor_list) {
+  const std::size_t num_vertices = neighbor_list.size();
+
+  std::vector<std::size_t> order(num_vertices);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&neighbor_list](const std::size_t a, const std::size_t b) {
+                     return neighbor_list[a].size() > neighbor_list[b].size();
+                   });
+
+  // used_by[c] == v marks the colors of the neighbors of v
+  constexpr std::int64_t NO_COLOR = -1;
+  std::vector<std::int64_t> color(num_vertices, NO_COLOR);
+  std::vector<std::size_t> used_by;
+  std::vector<std::vector<IndexType>> color_list;
+  for (const std::size_t v : order) {
+    for (const auto u : neighbor_list[v]) {
+      const auto c = color[static_cast<std::size_t>(u)];
+      if (c != NO_COLOR) {
+        used_by[c] = v;
+      }
+    }
+    std::size_t c = 0;
+    while (c < used_by.size() && used_by[c] == v) {
+      ++c;
+    }
+    if (c == used_by.size()) {
+      used_by.push_back(num_vertices);
+      color_list.emplace_back();
+    }
+    color[v] = static_cast<std::int64_t>(c);
+  }
+
+  for (std::size_t v = 0; v < num_vertices; ++v) {
+    color_list[color[v]].push_back(static_cast<IndexType>(v));
+  }
+  return color_list;
+}
+
+} // namespace utility
+} // namespace openjij
@@ -0,0 +1,228 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace openjij {
+namespace utility {
+
+/**
+ * @brief store of two-valued samples, each of which is bit-packed into a row
+ * of 64-bit words. Identical samples are merged with their occurrence counts
+ * as they are inserted, through an open-addressing hash table that OpenMP
+ * threads can insert into concurrently without locks.
+ *
+ * @tparam VariableType type of variables
+ * @tparam FloatType type of energies
+ */
+template <typename VariableType, typename FloatType> class PackedSampleStore {
+public:
+  using size_type = std::size_t;
+
+  /**
+   * @brief constructor
+   *
+   * @param system_size the number of variables in a sample
+   * @param max_num_samples the maximum number of insertions
+   * @param lower_value the value stored as bit 0
+   * @param upper_value the value stored as bit 1
+   */
+  PackedSampleStore(const size_type system_size,
+                    const size_type max_num_samples,
+                    const VariableType lower_value,
+                    const VariableType upper_value)
+      : _system_size(system_size), _num_words((system_size + 63) / 64),
+        _max_num_samples(max_num_samples), _lower_value(lower_value),
+        _upper_value(upper_value),
+        _words(max_num_samples * ((system_size + 63) / 64), 0),
+        _hash(max_num_samples, 0), _energy(max_num_samples, 0),
+        _count(new std::atomic<std::int32_t>[max_num_samples]) {
+    // Keep the load factor of the table at most one half
+    size_type table_size = 1;
+    while (table_size < 2 * max_num_samples) {
+      table_size *= 2;
+    }
+    _table = std::unique_ptr<std::atomic<std::int64_t>[]>(
+        new std::atomic<std::int64_t>[table_size]);
+    _table_mask = table_size - 1;
+    for (size_type i = 0; i < table_size; ++i) {
+      _table[i].store(EMPTY, std::memory_order_relaxed);
+    }
+    for (size_type i = 0; i < max_num_samples; ++i) {
+      _count[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  size_type system_size() const { return _system_size; }
+
+  /**
+   * @brief the number of words in a packed row
+   */
+  size_type num_words() const { return _num_words; }
+
+  /**
+   * @brief the number of insertions including duplicates
+   */
+  size_type num_samples() const {
+    return std::min<size_type>(_num_rows.load(), _max_num_samples);
+  }
+
+  /**
+   * @brief insert a sample, which is thread-safe
+   *
+   * @param sample sample whose values are lower_value or upper_value
+   *
+   * @return the row of the sample, and true if it has not been stored before
+   */
+  std::pair<size_type, bool> insert(const std::vector<VariableType> &sample) {
+    if (sample.size() != _system_size) {
+      throw std::runtime_error(
+          "The size of the sample is not equal to the system size.");
+    }
+    const std::int64_t row = _num_rows.fetch_add(1);
+    if (row >= static_cast<std::int64_t>(_max_num_samples)) {
+      throw std::runtime_error("The number of samples exceeds the capacity.");
+    }
+
+    // Pack the sample into its own row before publishing it to the table
+    std::uint64_t *words = &_words[row * _num_words];
+    for (size_type i = 0; i < _system_size; ++i) {
+      if (sample[i] == _upper_value) {
+        words[i / 64] |= std::uint64_t(1) << (i % 64);
+      }
+    }
+    const std::uint64_t hash = hash_row(words);
+    _hash[row] = hash;
+
+    size_type slot = hash & _table_mask;
+    while (true) {
+      std::int64_t stored = _table[slot].load(std::memory_order_acquire);
+      if (stored == EMPTY) {
+        if (_table[slot].compare_exchange_strong(stored, row,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+          _count[row].fetch_add(1, std::memory_order_relaxed);
+          return {static_cast<size_type>(row), true};
+        }
+        // Another thread has taken this slot, whose row is compared below
+      }
+      if (_hash[stored] == hash &&
+          std::equal(words, words + _num_words, &_words[stored * _num_words])) {
+        _count[stored].fetch_add(1, std::memory_order_relaxed);
+        return {static_cast<size_type>(stored), false};
+      }
+      slot = (slot + 1) & _table_mask;
+    }
+  }
+
+  /**
+   * @brief set the energy of a row
+   */
+  void set_energy(const size_type row, const FloatType energy) {
+    _energy[row] = energy;
+  }
+
+  FloatType energy(const size_type row) const { return _energy[row]; }
+
+  /**
+   * @brief the number of occurrences of the sample in a row
+   */
+  std::int32_t num_occurrences(const size_type row) const {
+    return _count[row].load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief the rows of the unique samples in the order of insertion, which
+   * must not be called during insertions
+   */
+  std::vector<size_type> unique_row_list() const {
+    std::vector<size_type> row_list;
+    const size_type num_rows = num_samples();
+    for (size_type row = 0; row < num_rows; ++row) {
+      if (_count[row].load(std::memory_order_relaxed) > 0) {
+        row_list.push_back(row);
+      }
+    }
+    return row_list;
+  }
+
+  /**
+   * @brief the packed words of a row
+   */
+  const std::uint64_t *packed_row(const size_type row) const {
+    return &_words[row * _num_words];
+  }
+
+  /**
+   * @brief unpack the sample in a row
+   */
+  std::vector<VariableType> sample(const size_type row) const {
+    std::vector<VariableType> sample(_system_size);
+    unpack(row, sample.data());
+    return sample;
+  }
+
+  /**
+   * @brief unpack the sample in a row into the given array of system_size
+   */
+  void unpack(const size_type row, VariableType *sample) const {
+    const std::uint64_t *words = packed_row(row);
+    for (size_type i = 0; i < _system_size; ++i) {
+      sample[i] =
+          ((words[i / 64] >> (i % 64)) & 1) ? _upper_value : _lower_value;
+    }
+  }
+
+private:
+  static constexpr std::int64_t EMPTY = -1;
+
+  std::uint64_t hash_row(const std::uint64_t *words) const {
+    // splitmix64 finalizer applied to each word
+    std::uint64_t hash = 0x9E3779B97F4A7C15ULL ^ _system_size;
+    for (size_type k = 0; k < _num_words; ++k) {
+      std::uint64_t z = hash ^ words[k];
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      hash = z ^ (z >> 31);
+    }
+    return hash;
+  }
+
+  size_type _system_size;
+  size_type _num_words;
+  size_type _max_num_samples;
+  VariableType _lower_value;
+  VariableType _upper_value;
+
+  std::vector<std::uint64_t> _words;
+  std::vector<std::uint64_t> _hash;
+  std::vector<FloatType> _energy;
+  std::unique_ptr<std::atomic<std::int32_t>[]> _count;
+  std::atomic<std::int64_t> _num_rows{0};
+
+  std::unique_ptr<std::atomic<std::int64_t>[]> _table;
+  size_type _table_mask;
+};
+
+} // namespace utility
+} // namespace openjij
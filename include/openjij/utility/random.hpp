@@ -14,8 +14,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <climits>
+#include <cstddef>
+#include <cstdint>
 #include <random>
+#include <type_traits>
+
+#include "openjij/utility/simd.hpp"
 
 #ifdef USE_CUDA
 
@@ -86,6 +93,557 @@ private:
   unsigned x = 123456789u, y = 362436069u, z = 521288629u, w;
 };
 
+/**
+ * @brief splitmix64 random generator, which is mainly used to derive
+ * statistically independent seeds from a seed and a stream index
+ */
+class SplitMix64 {
+public:
+  using result_type = std::uint64_t;
+
+  inline static constexpr result_type min() { return 0u; }
+
+  inline static constexpr result_type max() { return UINT64_MAX; }
+
+  /**
+   * @brief bijective finalizer of splitmix64
+   *
+   * @param z value to be mixed
+   *
+   * @return mixed value
+   */
+  inline static constexpr std::uint64_t mix(std::uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  /**
+   * @brief generate random number
+   *
+   * @return random number
+   */
+  inline result_type operator()() {
+    _state += 0x9E3779B97F4A7C15ULL;
+    return mix(_state);
+  }
+
+  /**
+   * @brief SplitMix64 constructor with seed
+   *
+   * @param s seed
+   */
+  explicit SplitMix64(std::uint64_t s = 0) : _state(s) {}
+
+private:
+  std::uint64_t _state;
+};
+
+/**
+ * @brief derive the seed of a stream from a seed, which does not depend on
+ * the order in which streams are created
+ *
+ * @param seed seed
+ * @param stream index of the stream
+ *
+ * @return seed of the stream
+ */
+inline std::uint64_t DeriveSeed(const std::uint64_t seed,
+                                const std::uint64_t stream) {
+  return SplitMix64::mix(SplitMix64::mix(seed) + stream);
+}
+
+/**
+ * @brief counter-based Philox4x32-10 random generator for c++11 random.
+ * The output is a pure function of the key (seed), the stream and the
+ * position in the stream, so that a random number can be generated at any
+ * point of the stream without sequential state, e.g. in vectorized kernels.
+ * Each block of four 32-bit words gives two 64-bit random numbers.
+ */
+class Philox4x32 {
+public:
+  using result_type = std::uint64_t;
+
+  using Block = std::array<std::uint32_t, 4>;
+
+  inline static constexpr result_type min() { return 0u; }
+
+  inline static constexpr result_type max() { return UINT64_MAX; }
+
+  /**
+   * @brief generate the block of a counter
+   *
+   * @param seed key of the generator
+   * @param stream upper 64 bits of the counter
+   * @param position lower 64 bits of the counter
+   *
+   * @return block of four 32-bit random words
+   */
+  inline static Block block(const std::uint64_t seed,
+                            const std::uint64_t stream,
+                            const std::uint64_t position) {
+    Block counter = {static_cast<std::uint32_t>(position),
+                     static_cast<std::uint32_t>(position >> 32),
+                     static_cast<std::uint32_t>(stream),
+                     static_cast<std::uint32_t>(stream >> 32)};
+    std::uint32_t key_0 = static_cast<std::uint32_t>(seed);
+    std::uint32_t key_1 = static_cast<std::uint32_t>(seed >> 32);
+    for (int round = 0; round < 10; ++round) {
+      const std::uint64_t product_0 =
+          static_cast<std::uint64_t>(0xD2511F53u) * counter[0];
+      const std::uint64_t product_1 =
+          static_cast<std::uint64_t>(0xCD9E8D57u) * counter[2];
+      counter = {static_cast<std::uint32_t>(product_1 >> 32) ^ counter[1] ^
+                     key_0,
+                 static_cast<std::uint32_t>(product_1),
+                 static_cast<std::uint32_t>(product_0 >> 32) ^ counter[3] ^
+                     key_1,
+                 static_cast<std::uint32_t>(product_0)};
+      key_0 += 0x9E3779B9u;
+      key_1 += 0xBB67AE85u;
+    }
+    return counter;
+  }
+
+  /**
+   * @brief generate random number
+   *
+   * @return random number
+   */
+  inline result_type operator()() {
+    if (_index == 0) {
+      _block = block(_seed, _stream, _position++);
+    }
+    const result_type value =
+        (static_cast<result_type>(_block[2 * _index + 1]) << 32) |
+        _block[2 * _index];
+    _index ^= 1;
+    return value;
+  }
+
+  /**
+   * @brief move to the beginning of a block in the stream
+   *
+   * @param position position of the block
+   */
+  void seek(const std::uint64_t position) {
+    _position = position;
+    _index = 0;
+  }
+
+  /**
+   * @brief skip random numbers
+   *
+   * @param z the number of random numbers to be skipped
+   */
+  void discard(unsigned long long z) {
+    if (_index == 1 && z > 0) {
+      _index = 0;
+      --z;
+    }
+    _position += z / 2;
+    if (z % 2 == 1) {
+      (*this)();
+    }
+  }
+
+  /**
+   * @brief Philox4x32 constructor
+   */
+  Philox4x32() {
+    std::random_device rd;
+    _seed = (static_cast<std::uint64_t>(rd()) << 32) | rd();
+  }
+
+  /**
+   * @brief Philox4x32 constructor with seed and stream
+   *
+   * @param seed seed
+   * @param stream index of the stream
+   */
+  explicit Philox4x32(std::uint64_t seed, std::uint64_t stream = 0)
+      : _seed(seed), _stream(stream) {}
+
+private:
+  std::uint64_t _seed;
+  std::uint64_t _stream = 0;
+  std::uint64_t _position = 0;
+  Block _block = {};
+  int _index = 0;
+};
+
+namespace xoshiro_detail {
+
+constexpr std::size_t NUM_LANES = 8;
+
+inline constexpr std::uint64_t rotl(const std::uint64_t x, const int k) {
+  return (x << k) | (x >> (64 - k));
+}
+
+/**
+ * @brief advance all the lanes num_blocks times and write their random
+ * numbers block by block
+ *
+ * @param s states of the lanes, aligned to 64 bytes
+ * @param out array of num_blocks*NUM_LANES numbers
+ * @param num_blocks the number of blocks
+ */
+inline void generate_scalar(std::uint64_t (*s)[NUM_LANES], std::uint64_t *out,
+                            const std::size_t num_blocks) {
+  for (std::size_t b = 0; b < num_blocks; ++b, out += NUM_LANES) {
+    for (std::size_t lane = 0; lane < NUM_LANES; ++lane) {
+      out[lane] = rotl(s[0][lane] + s[3][lane], 23) + s[0][lane];
+      const std::uint64_t t = s[1][lane] << 17;
+      s[2][lane] ^= s[0][lane];
+      s[3][lane] ^= s[1][lane];
+      s[1][lane] ^= s[2][lane];
+      s[0][lane] ^= s[3][lane];
+      s[2][lane] ^= t;
+      s[3][lane] = rotl(s[3][lane], 45);
+    }
+  }
+}
+
+#if OPENJIJ_SIMD_DISPATCH
+
+__attribute__((target("avx2"))) inline void
+generate_avx2(std::uint64_t (*s)[NUM_LANES], std::uint64_t *out,
+              const std::size_t num_blocks) {
+  for (std::size_t lane = 0; lane < NUM_LANES; lane += 4) {
+    __m256i s0 = _mm256_load_si256(reinterpret_cast<__m256i *>(&s[0][lane]));
+    __m256i s1 = _mm256_load_si256(reinterpret_cast<__m256i *>(&s[1][lane]));
+    __m256i s2 = _mm256_load_si256(reinterpret_cast<__m256i *>(&s[2][lane]));
+    __m256i s3 = _mm256_load_si256(reinterpret_cast<__m256i *>(&s[3][lane]));
+    for (std::size_t b = 0; b < num_blocks; ++b) {
+      const __m256i sum = _mm256_add_epi64(s0, s3);
+      const __m256i result = _mm256_add_epi64(
+          _mm256_or_si256(_mm256_slli_epi64(sum, 23),
+                          _mm256_srli_epi64(sum, 41)),
+          s0);
+      const __m256i t = _mm256_slli_epi64(s1, 17);
+      s2 = _mm256_xor_si256(s2, s0);
+      s3 = _mm256_xor_si256(s3, s1);
+      s1 = _mm256_xor_si256(s1, s2);
+      s0 = _mm256_xor_si256(s0, s3);
+      s2 = _mm256_xor_si256(s2, t);
+      s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45),
+                           _mm256_srli_epi64(s3, 19));
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i *>(out + b * NUM_LANES + lane), result);
+    }
+    _mm256_store_si256(reinterpret_cast<__m256i *>(&s[0][lane]), s0);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(&s[1][lane]), s1);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(&s[2][lane]), s2);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(&s[3][lane]), s3);
+  }
+}
+
+// GCC 12 reports the undefined vectors inside the AVX-512 intrinsics as maybe
+// uninitialized (GCC bug 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+__attribute__((target("avx512f"))) inline void
+generate_avx512(std::uint64_t (*s)[NUM_LANES], std::uint64_t *out,
+                const std::size_t num_blocks) {
+  __m512i s0 = _mm512_load_si512(s[0]);
+  __m512i s1 = _mm512_load_si512(s[1]);
+  __m512i s2 = _mm512_load_si512(s[2]);
+  __m512i s3 = _mm512_load_si512(s[3]);
+  for (std::size_t b = 0; b < num_blocks; ++b) {
+    const __m512i result =
+        _mm512_add_epi64(_mm512_rol_epi64(_mm512_add_epi64(s0, s3), 23), s0);
+    const __m512i t = _mm512_slli_epi64(s1, 17);
+    s2 = _mm512_xor_si512(s2, s0);
+    s3 = _mm512_xor_si512(s3, s1);
+    s1 = _mm512_xor_si512(s1, s2);
+    s0 = _mm512_xor_si512(s0, s3);
+    s2 = _mm512_xor_si512(s2, t);
+    s3 = _mm512_rol_epi64(s3, 45);
+    _mm512_storeu_si512(out + b * NUM_LANES, result);
+  }
+  _mm512_store_si512(s[0], s0);
+  _mm512_store_si512(s[1], s1);
+  _mm512_store_si512(s[2], s2);
+  _mm512_store_si512(s[3], s3);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+/**
+ * @brief generate num_blocks blocks with the given instruction set, which
+ * must be supported by the CPU
+ */
+inline void generate(const SimdLevel level, std::uint64_t (*s)[NUM_LANES],
+                     std::uint64_t *out, const std::size_t num_blocks) {
+#if OPENJIJ_SIMD_DISPATCH
+  if (level == SimdLevel::AVX512) {
+    generate_avx512(s, out, num_blocks);
+    return;
+  }
+  if (level == SimdLevel::AVX2) {
+    generate_avx2(s, out, num_blocks);
+    return;
+  }
+#endif
+  generate_scalar(s, out, num_blocks);
+}
+
+} // namespace xoshiro_detail
+
+/**
+ * @brief xoshiro256++ random generator running num_lanes independent streams
+ * side by side, so that blocks of num_lanes random numbers are generated with
+ * AVX-512 or AVX2 kernels selected at run time (or a scalar loop where neither
+ * is available). The streams are seeded with splitmix64 and the numbers are
+ * returned lane by lane, thus the sequence does not depend on the instruction
+ * set.
+ */
+class Xoshiro256pp {
+public:
+  using result_type = std::uint64_t;
+
+  static constexpr std::size_t num_lanes = xoshiro_detail::NUM_LANES;
+
+  inline static constexpr result_type min() { return 0u; }
+
+  inline static constexpr result_type max() { return UINT64_MAX; }
+
+  /**
+   * @brief generate random number
+   *
+   * @return random number
+   */
+  inline result_type operator()() {
+    if (_index == num_lanes) {
+      xoshiro_detail::generate(simd_level(), _s, _buffer, 1);
+      _index = 0;
+    }
+    return _buffer[_index++];
+  }
+
+  /**
+   * @brief generate a uniform random number on [0, 1) with the upper bits of
+   * a random number, which needs neither a loop nor a branch
+   *
+   * @tparam FloatType float or double
+   *
+   * @return uniform random number
+   */
+  template <typename FloatType> inline FloatType uniform() {
+    return to_uniform<FloatType>((*this)());
+  }
+
+  /**
+   * @brief fill an array with uniform random numbers on [0, 1), which gives
+   * the same numbers as n calls of uniform()
+   *
+   * @tparam FloatType float or double
+   * @param out array of n numbers
+   * @param n the number of random numbers
+   */
+  template <typename FloatType>
+  void fill_uniform(FloatType *out, const std::size_t n) {
+    std::size_t k = 0;
+    for (; k < n && _index < num_lanes; ++k) {
+      out[k] = to_uniform<FloatType>(_buffer[_index++]);
+    }
+    // the blocks are generated in chunks, so that the state stays in the
+    // registers of the kernel over a chunk
+    constexpr std::size_t max_num_blocks = 32;
+    alignas(64) std::uint64_t block[max_num_blocks * num_lanes];
+    const SimdLevel level = simd_level();
+    while (k + num_lanes <= n) {
+      const std::size_t num_blocks =
+          std::min(max_num_blocks, (n - k) / num_lanes);
+      xoshiro_detail::generate(level, _s, block, num_blocks);
+      for (std::size_t i = 0; i < num_blocks * num_lanes; ++i) {
+        out[k + i] = to_uniform<FloatType>(block[i]);
+      }
+      k += num_blocks * num_lanes;
+    }
+    for (; k < n; ++k) {
+      out[k] = uniform<FloatType>();
+    }
+  }
+
+  /**
+   * @brief Xoshiro256pp constructor
+   */
+  Xoshiro256pp() : Xoshiro256pp(std::random_device()()) {}
+
+  /**
+   * @brief Xoshiro256pp constructor with seed
+   *
+   * @param seed seed
+   */
+  explicit Xoshiro256pp(std::uint64_t seed) {
+    SplitMix64 seed_engine(seed);
+    for (std::size_t lane = 0; lane < num_lanes; ++lane) {
+      for (std::size_t k = 0; k < 4; ++k) {
+        _s[k][lane] = seed_engine();
+      }
+    }
+  }
+
+private:
+  template <typename FloatType>
+  inline static FloatType to_uniform(const std::uint64_t x) {
+    static_assert(std::is_floating_point<FloatType>::value,
+                  "FloatType must be float or double.");
+    if (std::is_same<FloatType, float>::value) {
+      return static_cast<FloatType>(static_cast<std::int32_t>(x >> 40)) *
+             static_cast<FloatType>(0x1.0p-24);
+    }
+    return static_cast<FloatType>(static_cast<std::int64_t>(x >> 11)) *
+           static_cast<FloatType>(0x1.0p-53);
+  }
+
+  alignas(64) std::uint64_t _s[4][num_lanes];
+  alignas(64) std::uint64_t _buffer[num_lanes];
+  std::size_t _index = num_lanes;
+};
+
+/**
+ * @brief PCG64 random generator (128-bit linear congruential generator with
+ * the XSL RR output function) for c++11 random
+ */
+class PCG64 {
+public:
+  using result_type = std::uint64_t;
+
+  inline static constexpr result_type min() { return 0u; }
+
+  inline static constexpr result_type max() { return UINT64_MAX; }
+
+  /**
+   * @brief generate random number
+   *
+   * @return random number
+   */
+  inline result_type operator()() {
+    step();
+    const std::uint64_t x = _state_hi ^ _state_lo;
+    const int rot = static_cast<int>(_state_hi >> 58);
+    return (x >> rot) | (x << ((-rot) & 63));
+  }
+
+  /**
+   * @brief PCG64 constructor
+   */
+  PCG64() : PCG64(std::random_device()()) {}
+
+  /**
+   * @brief PCG64 constructor with seed and stream
+   *
+   * @param seed seed
+   * @param stream index of the stream
+   */
+  explicit PCG64(std::uint64_t seed, std::uint64_t stream = 0)
+      : _inc_hi(stream >> 63), _inc_lo((stream << 1) | 1) {
+    step();
+    add(_state_hi, _state_lo, 0, seed);
+    step();
+  }
+
+private:
+  inline static void add(std::uint64_t &hi, std::uint64_t &lo,
+                         const std::uint64_t b_hi, const std::uint64_t b_lo) {
+    const std::uint64_t sum = lo + b_lo;
+    hi += b_hi + (sum < lo);
+    lo = sum;
+  }
+
+  inline static void mul_64x64(const std::uint64_t a, const std::uint64_t b,
+                               std::uint64_t &hi, std::uint64_t &lo) {
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    hi = static_cast<std::uint64_t>(product >> 64);
+    lo = static_cast<std::uint64_t>(product);
+#else
+    const std::uint64_t a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+    const std::uint64_t b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+    const std::uint64_t p_ll = a_lo * b_lo, p_lh = a_lo * b_hi;
+    const std::uint64_t p_hl = a_hi * b_lo, p_hh = a_hi * b_hi;
+    const std::uint64_t mid = (p_ll >> 32) + (p_lh & 0xFFFFFFFFu) + (p_hl & 0xFFFFFFFFu);
+    hi = p_hh + (p_lh >> 32) + (p_hl >> 32) + (mid >> 32);
+    lo = (mid << 32) | (p_ll & 0xFFFFFFFFu);
+#endif
+  }
+
+  //! @brief state = state*multiplier + increment (mod 2^128)
+  inline void step() {
+    constexpr std::uint64_t multiplier_hi = 2549297995355413924ULL;
+    constexpr std::uint64_t multiplier_lo = 4865540595714422341ULL;
+    std::uint64_t hi, lo;
+    mul_64x64(_state_lo, multiplier_lo, hi, lo);
+    hi += _state_hi * multiplier_lo + _state_lo * multiplier_hi;
+    add(hi, lo, _inc_hi, _inc_lo);
+    _state_hi = hi;
+    _state_lo = lo;
+  }
+
+  std::uint64_t _state_hi = 0, _state_lo = 0;
+  std::uint64_t _inc_hi, _inc_lo;
+};
+
+/**
+ * @brief uniform real distribution on [0, 1), which is the same as
+ * std::uniform_real_distribution except that the random numbers of
+ * Xoshiro256pp are converted without a loop or a branch
+ *
+ * @tparam FloatType float or double
+ */
+template <typename FloatType> class UniformRealDistribution {
+public:
+  using result_type = FloatType;
+
+  /**
+   * @brief generate a uniform random number
+   *
+   * @param random_number_engine random number engine
+   *
+   * @return uniform random number
+   */
+  template <typename RandType>
+  inline FloatType operator()(RandType &random_number_engine) {
+    return _dist(random_number_engine);
+  }
+
+  inline FloatType operator()(Xoshiro256pp &random_number_engine) {
+    return random_number_engine.uniform<FloatType>();
+  }
+
+  /**
+   * @brief fill an array with uniform random numbers, which are generated in
+   * blocks by Xoshiro256pp
+   *
+   * @param random_number_engine random number engine
+   * @param out array of n numbers
+   * @param n the number of random numbers
+   */
+  template <typename RandType, typename OutType>
+  void fill(RandType &random_number_engine, OutType *out, const std::size_t n) {
+    for (std::size_t k = 0; k < n; ++k) {
+      out[k] = _dist(random_number_engine);
+    }
+  }
+
+  template <typename OutType>
+  void fill(Xoshiro256pp &random_number_engine, OutType *out,
+            const std::size_t n) {
+    random_number_engine.fill_uniform(out, n);
+  }
+
+private:
+  std::uniform_real_distribution<FloatType> _dist{0, 1};
+};
+
 #ifdef USE_CUDA
 namespace cuda {
 template <typename FloatType>
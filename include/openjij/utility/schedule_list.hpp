@@ -13,8 +13,11 @@
 //    limitations under the License.
 
 #pragma once
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <stdexcept>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -264,6 +267,12 @@ enum class TemperatureSchedule {
    //! @brief Geometric cooling
    GEOMETRIC,
    
+   //! @brief Power-law cooling, which is linear if the exponent is one
+   POWER_LAW,
+   
+   //! @brief Geometric cooling followed by a plateau at the maximum inverse temperature
+   EXPONENTIAL_PLATEAU,
+   
 };
 
 //! @brief Generate linear temperature schedule
@@ -305,18 +314,86 @@ std::vector<FloatType> GenerateGeometricBetaSchedule(const FloatType beta_min, c
    return beta_list;
 }
 
+//! @brief Generate power-law temperature schedule, where the inverse temperature of the i-th sweep is
+//! \f$ \beta_{\rm min} + (\beta_{\rm max} - \beta_{\rm min})(i/(N - 1))^p \f$.
+//! @tparam FloatType Floating point type
+//! @param beta_min The minimum value of inverse temperature
+//! @param beta_max The maximum value of inverse temperature
+//! @param num_sweeps The number of sweeps
+//! @param exponent The exponent \f$ p \f$, which must be larger than zero
+//! @return Power-law temperature schedule
+template<typename FloatType>
+std::vector<FloatType> GeneratePowerLawBetaSchedule(const FloatType beta_min, const FloatType beta_max, const std::int32_t num_sweeps, const FloatType exponent) {
+   if (!(exponent > 0)) {
+      throw std::runtime_error("exponent must be larger than zero.");
+   }
+   if (num_sweeps == 1) {
+      return std::vector<FloatType>{beta_min};
+   }
+   std::vector<FloatType> beta_list(num_sweeps);
+   for (std::int32_t i = 0; i < num_sweeps; ++i) {
+      const FloatType progress = static_cast<FloatType>(i)/(num_sweeps - 1);
+      beta_list[i] = beta_min + (beta_max - beta_min)*std::pow(progress, exponent);
+   }
+   return beta_list;
+}
+
+//! @brief Generate geometric temperature schedule followed by a plateau,
+//! which reaches beta_max after the first (1 - plateau_ratio) of the sweeps and stays there.
+//! @tparam FloatType Floating point type
+//! @param beta_min The minimum value of inverse temperature
+//! @param beta_max The maximum value of inverse temperature
+//! @param num_sweeps The number of sweeps
+//! @param plateau_ratio The ratio of the sweeps at beta_max, which must be in [0, 1)
+//! @return Geometric temperature schedule with a plateau
+template<typename FloatType>
+std::vector<FloatType> GenerateExponentialPlateauBetaSchedule(const FloatType beta_min, const FloatType beta_max, const std::int32_t num_sweeps, const FloatType plateau_ratio) {
+   if (!(0 <= plateau_ratio && plateau_ratio < 1)) {
+      throw std::runtime_error("plateau_ratio must be in [0, 1).");
+   }
+   const std::int32_t num_plateau_sweeps = static_cast<std::int32_t>(plateau_ratio*num_sweeps);
+   const std::int32_t num_cooling_sweeps = std::max<std::int32_t>(num_sweeps - num_plateau_sweeps, 1);
+   std::vector<FloatType> beta_list = GenerateGeometricBetaSchedule(beta_min, beta_max, num_cooling_sweeps);
+   beta_list.resize(num_sweeps, beta_max);
+   return beta_list;
+}
+
+//! @brief Repeat each inverse temperature of a schedule.
+//! @tparam FloatType Floating point type
+//! @param beta_list The inverse temperatures
+//! @param num_repeats_list The number of sweeps at each inverse temperature, each of which must be larger than zero
+//! @return The inverse temperature of each sweep
+template<typename FloatType>
+std::vector<FloatType> RepeatBetaList(const std::vector<FloatType> &beta_list, const std::vector<std::int32_t> &num_repeats_list) {
+   if (beta_list.size() != num_repeats_list.size()) {
+      throw std::runtime_error("The sizes of beta_list and num_repeats_list are not equal.");
+   }
+   std::vector<FloatType> repeated_beta_list;
+   for (std::size_t i = 0; i < beta_list.size(); ++i) {
+      if (num_repeats_list[i] <= 0) {
+         throw std::runtime_error("The number of repeats must be larger than zero.");
+      }
+      repeated_beta_list.insert(repeated_beta_list.end(), num_repeats_list[i], beta_list[i]);
+   }
+   return repeated_beta_list;
+}
+
 //! @brief Generate temperature schedule from specific schedule
 //! @tparam FloatType Floating point type
 //! @param schedule_type The type of temperature schedule
 //! @param beta_min The minimum value of inverse temperature
 //! @param beta_max The maximum value of inverse temperature
 //! @param num_sweeps The number of sweeps
+//! @param exponent The exponent of the power-law schedule
+//! @param plateau_ratio The ratio of the sweeps at beta_max in the exponential-plateau schedule
 //! @return Temperature schedule
 template<typename FloatType>
 std::vector<FloatType> GenerateBetaList(const TemperatureSchedule schedule_type,
                                         const FloatType beta_min,
                                         const FloatType beta_max,
-                                        const std::int32_t num_sweeps) {
+                                        const std::int32_t num_sweeps,
+                                        const FloatType exponent = 2,
+                                        const FloatType plateau_ratio = 0.5) {
    std::vector<FloatType> beta_list;
    if (schedule_type == TemperatureSchedule::LINEAR) {
       beta_list = GenerateLinearBetaSchedule(beta_min, beta_max, num_sweeps);
@@ -324,6 +401,12 @@ std::vector<FloatType> GenerateBetaList(const TemperatureSchedule schedule_type,
    else if (schedule_type == TemperatureSchedule::GEOMETRIC) {
       beta_list = GenerateGeometricBetaSchedule(beta_min, beta_max, num_sweeps);
    }
+   else if (schedule_type == TemperatureSchedule::POWER_LAW) {
+      beta_list = GeneratePowerLawBetaSchedule(beta_min, beta_max, num_sweeps, exponent);
+   }
+   else if (schedule_type == TemperatureSchedule::EXPONENTIAL_PLATEAU) {
+      beta_list = GenerateExponentialPlateauBetaSchedule(beta_min, beta_max, num_sweeps, plateau_ratio);
+   }
    else {
       throw std::runtime_error("Unknwon beta schedule list");
    }
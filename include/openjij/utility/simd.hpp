@@ -0,0 +1,228 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// The kernels are compiled for AVX2 and AVX-512 with function attributes and
+// selected at run time, so that the binary does not require these extensions.
+#if (defined(__GNUC__) || defined(__clang__)) &&                               \
+    (defined(__x86_64__) || defined(__i386__))
+#define OPENJIJ_SIMD_DISPATCH 1
+#include <immintrin.h>
+#else
+#define OPENJIJ_SIMD_DISPATCH 0
+#endif
+
+namespace openjij {
+namespace utility {
+
+/**
+ * @brief bfloat16, the upper half of an IEEE binary32, which is converted to
+ * float exactly and from float with rounding to nearest even
+ */
+struct BFloat16 {
+  std::uint16_t bits = 0;
+
+  BFloat16() = default;
+
+  explicit BFloat16(const float value) : bits(from_float(value)) {}
+
+  explicit operator float() const { return to_float(bits); }
+
+  static std::uint16_t from_float(const float value) {
+    std::uint32_t x;
+    std::memcpy(&x, &value, sizeof(x));
+    if ((x & 0x7FFFFFFFu) > 0x7F800000u) {
+      // keep NaN quiet instead of rounding it to infinity
+      return static_cast<std::uint16_t>((x >> 16) | 0x0040u);
+    }
+    x += 0x7FFFu + ((x >> 16) & 1u);
+    return static_cast<std::uint16_t>(x >> 16);
+  }
+
+  static float to_float(const std::uint16_t bits) {
+    const std::uint32_t x = static_cast<std::uint32_t>(bits) << 16;
+    float value;
+    std::memcpy(&value, &x, sizeof(value));
+    return value;
+  }
+};
+
+/**
+ * @brief convert a stored value to float
+ */
+inline float to_float(const float value) { return value; }
+
+inline float to_float(const BFloat16 value) {
+  return static_cast<float>(value);
+}
+
+/**
+ * @brief instruction set used by the SIMD kernels
+ */
+enum class SimdLevel {
+  SCALAR,
+  AVX2,
+  AVX512,
+};
+
+/**
+ * @brief the widest instruction set supported by the running CPU, which is
+ * detected once
+ *
+ * @return instruction set
+ */
+inline SimdLevel simd_level() {
+  static const SimdLevel level = [] {
+#if OPENJIJ_SIMD_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+      return SimdLevel::AVX2;
+    }
+#endif
+    return SimdLevel::SCALAR;
+  }();
+  return level;
+}
+
+namespace simd_detail {
+
+template <typename StorageType>
+inline void spin_axpy_scalar(const float coeff, const StorageType *row,
+                             const std::int8_t *spin, float *y,
+                             const std::size_t begin, const std::size_t end) {
+  for (std::size_t j = begin; j < end; ++j) {
+    y[j] += coeff * (to_float(row[j]) * spin[j]);
+  }
+}
+
+#if OPENJIJ_SIMD_DISPATCH
+
+__attribute__((target("avx2,fma"))) inline __m256
+load_row_avx2(const float *row) {
+  return _mm256_loadu_ps(row);
+}
+
+__attribute__((target("avx2,fma"))) inline __m256
+load_row_avx2(const BFloat16 *row) {
+  const __m128i bits =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(row));
+  return _mm256_castsi256_ps(
+      _mm256_slli_epi32(_mm256_cvtepu16_epi32(bits), 16));
+}
+
+template <typename StorageType>
+__attribute__((target("avx2,fma"))) void
+spin_axpy_avx2(const float coeff, const StorageType *row,
+               const std::int8_t *spin, float *y, const std::size_t size) {
+  const __m256 c = _mm256_set1_ps(coeff);
+  std::size_t j = 0;
+  for (; j + 8 <= size; j += 8) {
+    const __m256 s = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(spin + j))));
+    const __m256 js = _mm256_mul_ps(load_row_avx2(row + j), s);
+    _mm256_storeu_ps(y + j, _mm256_fmadd_ps(c, js, _mm256_loadu_ps(y + j)));
+  }
+  spin_axpy_scalar(coeff, row, spin, y, j, size);
+}
+
+// GCC 12 reports the undefined vectors inside the AVX-512 intrinsics as maybe
+// uninitialized (GCC bug 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+__attribute__((target("avx512f"))) inline __m512
+load_row_avx512(const float *row) {
+  return _mm512_loadu_ps(row);
+}
+
+__attribute__((target("avx512f"))) inline __m512
+load_row_avx512(const BFloat16 *row) {
+  const __m256i bits =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row));
+  return _mm512_castsi512_ps(
+      _mm512_slli_epi32(_mm512_cvtepu16_epi32(bits), 16));
+}
+
+template <typename StorageType>
+__attribute__((target("avx512f"))) void
+spin_axpy_avx512(const float coeff, const StorageType *row,
+                 const std::int8_t *spin, float *y, const std::size_t size) {
+  const __m512 c = _mm512_set1_ps(coeff);
+  std::size_t j = 0;
+  for (; j + 16 <= size; j += 16) {
+    const __m512 s = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(spin + j))));
+    const __m512 js = _mm512_mul_ps(load_row_avx512(row + j), s);
+    _mm512_storeu_ps(y + j, _mm512_fmadd_ps(c, js, _mm512_loadu_ps(y + j)));
+  }
+  spin_axpy_scalar(coeff, row, spin, y, j, size);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+} // namespace simd_detail
+
+/**
+ * @brief y[j] += coeff * row[j] * spin[j] for j < size, accumulated in float
+ *
+ * @tparam StorageType float or BFloat16
+ * @param level instruction set, which must be supported by the CPU
+ * @param coeff coefficient
+ * @param row row of couplings
+ * @param spin spins of +1 or -1
+ * @param y array to be updated
+ * @param size the number of elements
+ */
+template <typename StorageType>
+inline void spin_axpy(const SimdLevel level, const float coeff,
+                      const StorageType *row, const std::int8_t *spin,
+                      float *y, const std::size_t size) {
+#if OPENJIJ_SIMD_DISPATCH
+  if (level == SimdLevel::AVX512) {
+    simd_detail::spin_axpy_avx512(coeff, row, spin, y, size);
+    return;
+  }
+  if (level == SimdLevel::AVX2) {
+    simd_detail::spin_axpy_avx2(coeff, row, spin, y, size);
+    return;
+  }
+#endif
+  simd_detail::spin_axpy_scalar(coeff, row, spin, y, 0, size);
+}
+
+/**
+ * @brief spin_axpy with the widest instruction set of the CPU
+ */
+template <typename StorageType>
+inline void spin_axpy(const float coeff, const StorageType *row,
+                      const std::int8_t *spin, float *y,
+                      const std::size_t size) {
+  spin_axpy(simd_level(), coeff, row, spin, y, size);
+}
+
+} // namespace utility
+} // namespace openjij
@@ -15,7 +15,9 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <memory>
 #include <numeric>
 #include <vector>
 
@@ -80,5 +82,84 @@ private:
   Parent _parent;
   Rank _rank;
 };
+
+/**
+ * @brief union-find tree whose sets can be united by OpenMP threads at the
+ * same time without locks. The larger root is always linked under the
+ * smaller one by compare-and-swap, so that the root of a set is its smallest
+ * node whatever the order of the unions is.
+ */
+class ConcurrentUnionFind {
+public:
+  using Node = std::size_t;
+  using size_type = std::size_t;
+
+  explicit ConcurrentUnionFind(size_type n = 0) { reset(n); }
+
+  /**
+   * @brief make each of n nodes a set, where the storage is reallocated only
+   * if it is smaller than n
+   *
+   * @param n the number of nodes
+   */
+  void reset(const size_type n) {
+    if (n > _capacity) {
+      _parent = std::unique_ptr<std::atomic<Node>[]>(new std::atomic<Node>[n]);
+      _capacity = n;
+    }
+    _size = n;
+    for (size_type i = 0; i < n; ++i) {
+      _parent[i].store(i, std::memory_order_relaxed);
+    }
+  }
+
+  size_type size() const { return _size; }
+
+  /**
+   * @brief unite the sets of two nodes, which is thread-safe
+   */
+  void unite_sets(Node x, Node y) {
+    while (true) {
+      x = find_set(x);
+      y = find_set(y);
+      if (x == y) {
+        return;
+      }
+      if (x < y) {
+        std::swap(x, y);
+      }
+      // x may have been linked by another thread, then retry from the roots
+      Node expected = x;
+      if (_parent[x].compare_exchange_strong(expected, y,
+                                             std::memory_order_acq_rel)) {
+        return;
+      }
+    }
+  }
+
+  /**
+   * @brief find the root of a node with path halving, which is thread-safe
+   */
+  Node find_set(Node node) {
+    while (true) {
+      Node parent = _parent[node].load(std::memory_order_acquire);
+      if (parent == node) {
+        return node;
+      }
+      const Node grandparent = _parent[parent].load(std::memory_order_acquire);
+      if (grandparent != parent) {
+        // a failed exchange only leaves a longer path
+        _parent[node].compare_exchange_weak(parent, grandparent,
+                                            std::memory_order_acq_rel);
+      }
+      node = grandparent;
+    }
+  }
+
+private:
+  std::unique_ptr<std::atomic<Node>[]> _parent;
+  size_type _size = 0;
+  size_type _capacity = 0;
+};
 } // namespace utility
 } // namespace openjij
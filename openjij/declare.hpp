@@ -18,6 +18,7 @@
 #include <pybind11/stl.h>
 #include <pybind11/functional.h>
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 
 #include <pybind11_json/pybind11_json.hpp>
 
@@ -29,6 +30,8 @@
 #include <openjij/system/all.hpp>
 #include <openjij/updater/all.hpp>
 #include <openjij/sampler/sa_sampler.hpp>
+#include <openjij/sampler/pt_sampler.hpp>
+#include <openjij/sampler/houdayer_pt_sampler.hpp>
 #include <openjij/sampler/integer_sa_sampler.hpp>
 
 namespace py = pybind11;
@@ -39,6 +42,31 @@ namespace openjij {
 
 // NOTE: please add `py::module_local()` when defining `py::class_`
 
+// Expose a buffer to numpy without copying. The array holds a reference to
+// the buffer, so it stays valid after the owner of the buffer is gone.
+template <typename T>
+py::array_t<T> to_numpy_array(const std::shared_ptr<const std::vector<T>> &buffer,
+                              const std::vector<py::ssize_t> &shape,
+                              const bool writeable = false) {
+  auto *holder = new std::shared_ptr<const std::vector<T>>(buffer);
+  py::capsule owner(holder, [](void *p) {
+    delete reinterpret_cast<std::shared_ptr<const std::vector<T>> *>(p);
+  });
+  py::array_t<T> array(shape, buffer->data(), owner);
+  if (!writeable) {
+    py::detail::array_proxy(array.ptr())->flags &=
+        ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+  }
+  return array;
+}
+
+template <typename T>
+py::array_t<T> to_numpy_array(std::vector<T> &&vector) {
+  const py::ssize_t size = vector.size();
+  return to_numpy_array<T>(
+      std::make_shared<const std::vector<T>>(std::move(vector)), {size}, true);
+}
+
 // graph
 inline void declare_Graph(py::module &m) {
   py::class_<graph::Graph>(m, "Graph", py::module_local())
@@ -414,7 +442,8 @@ inline void declare_ClassicalIsing(py::module &m,
   using ClassicalIsing = system::ClassicalIsing<GraphType>;
 
   auto str = std::string("ClassicalIsing") + gtype_str;
-  py::class_<ClassicalIsing>(m, str.c_str(), py::module_local())
+  py::class_<ClassicalIsing> py_class(m, str.c_str(), py::module_local());
+  py_class
       .def(py::init<const graph::Spins &, const GraphType &>(), "init_spin"_a,
            "init_interaction"_a)
       .def(
@@ -425,7 +454,8 @@ inline void declare_ClassicalIsing(py::module &m,
           "init_spin"_a)
       .def_readwrite("spin", &ClassicalIsing::spin)
       .def_readonly("interaction", &ClassicalIsing::interaction)
-      .def_readonly("num_spins", &ClassicalIsing::num_spins);
+      .def_readonly("num_spins", &ClassicalIsing::num_spins)
+      .def_readonly("energy", &ClassicalIsing::energy);
 
   // make_classical_ising
   auto mkci_str = std::string("make_classical_ising");
@@ -437,6 +467,72 @@ inline void declare_ClassicalIsing(py::module &m,
       "init_spin"_a, "init_interaction"_a);
 }
 
+// CompactClassicalIsing
+template <typename GraphType, typename StorageType>
+inline void declare_CompactClassicalIsing(py::module &m,
+                                          const std::string &gtype_str,
+                                          const std::string &make_str) {
+  using CompactClassicalIsing =
+      system::CompactClassicalIsing<GraphType, StorageType>;
+
+  auto str = std::string("CompactClassicalIsing") + gtype_str;
+  py::class_<CompactClassicalIsing>(m, str.c_str(), py::module_local())
+      .def(py::init<const graph::Spins &, const GraphType &>(), "init_spin"_a,
+           "init_interaction"_a)
+      .def(
+          "reset_spins",
+          [](CompactClassicalIsing &self, const graph::Spins &init_spin) {
+            self.reset_spins(init_spin);
+          },
+          "init_spin"_a)
+      .def_readonly("spin", &CompactClassicalIsing::spin)
+      .def_readonly("num_spins", &CompactClassicalIsing::num_spins)
+      .def_readonly("energy", &CompactClassicalIsing::energy);
+
+  m.def(
+      make_str.c_str(),
+      [](const graph::Spins &init_spin, const GraphType &init_interaction) {
+        return system::make_compact_classical_ising<StorageType>(
+            init_spin, init_interaction);
+      },
+      "init_spin"_a, "init_interaction"_a);
+}
+
+// ReplicaPackedClassicalIsing
+template <typename GraphType>
+inline void declare_ReplicaPackedClassicalIsing(py::module &m,
+                                                const std::string &gtype_str) {
+  using ReplicaPackedClassicalIsing =
+      system::ReplicaPackedClassicalIsing<GraphType>;
+
+  auto str = std::string("ReplicaPackedClassicalIsing") + gtype_str;
+  py::class_<ReplicaPackedClassicalIsing>(m, str.c_str(), py::module_local())
+      .def(py::init<const std::vector<graph::Spins> &, const GraphType &>(),
+           "init_spins"_a, "init_interaction"_a)
+      .def(
+          "reset_spins",
+          [](ReplicaPackedClassicalIsing &self,
+             const std::vector<graph::Spins> &init_spins) {
+            self.reset_spins(init_spins);
+          },
+          "init_spins"_a)
+      .def_readonly("spin", &ReplicaPackedClassicalIsing::spin)
+      .def_readonly("interaction", &ReplicaPackedClassicalIsing::interaction)
+      .def_readonly("num_spins", &ReplicaPackedClassicalIsing::num_spins)
+      .def_readonly("num_replicas",
+                    &ReplicaPackedClassicalIsing::num_replicas)
+      .def_readonly("energy", &ReplicaPackedClassicalIsing::energy);
+
+  m.def(
+      "make_replica_packed_classical_ising",
+      [](const std::vector<graph::Spins> &init_spins,
+         const GraphType &init_interaction) {
+        return system::make_replica_packed_classical_ising(init_spins,
+                                                           init_interaction);
+      },
+      "init_spins"_a, "init_interaction"_a);
+}
+
 // ClassicalIsingPolynomial
 template <typename GraphType>
 inline void declare_ClassicalIsingPolynomial(py::module &m,
@@ -792,6 +888,119 @@ inline void declare_Algorithm_run(py::module &m,
       "system"_a, "tuplelist"_a, "callback"_a = nullptr);
 }
 
+// ColoredSingleSpinFlip, whose coloring is made once by generate_color_list
+// and passed to each run together with the number of threads
+template <typename System, typename RandomNumberEngine>
+inline void declare_ColoredSingleSpinFlip_run(py::module &m) {
+  using Updater = updater::ColoredSingleSpinFlip<System>;
+  using ColorList = std::vector<std::vector<std::size_t>>;
+
+  m.def(
+      "generate_color_list",
+      [](const System &system) { return Updater::generate_color_list(system); },
+      "system"_a);
+
+  // with seed
+  m.def(
+      "Algorithm_ColoredSingleSpinFlip_run",
+      [](System &system, std::size_t seed,
+         const utility::ClassicalScheduleList &schedule_list,
+         const ColorList &color_list, const int num_threads) {
+        py::gil_scoped_release release;
+        RandomNumberEngine rng(seed);
+        Updater::run(system, rng, schedule_list, color_list, num_threads);
+        py::gil_scoped_acquire acquire;
+      },
+      "system"_a, "seed"_a, "schedule_list"_a, "color_list"_a,
+      "num_threads"_a = 0);
+
+  // without seed
+  m.def(
+      "Algorithm_ColoredSingleSpinFlip_run",
+      [](System &system, const utility::ClassicalScheduleList &schedule_list,
+         const ColorList &color_list, const int num_threads) {
+        py::gil_scoped_release release;
+        RandomNumberEngine rng(std::random_device{}());
+        Updater::run(system, rng, schedule_list, color_list, num_threads);
+        py::gil_scoped_acquire acquire;
+      },
+      "system"_a, "schedule_list"_a, "color_list"_a, "num_threads"_a = 0);
+}
+
+// batch of num_reads independent runs
+template <template <typename> class Updater, typename System,
+          typename RandomNumberEngine, typename InitState>
+inline std::pair<std::vector<graph::Spins>, std::vector<double>>
+run_batch_impl(const System &system, const std::vector<InitState> &init_states,
+               const std::size_t seed,
+               const utility::ScheduleList<
+                   typename system::get_system_type<System>::type>
+                   &schedule_list,
+               const int num_threads) {
+  const std::int64_t num_reads = init_states.size();
+
+  // per-read seeds are drawn from a single engine so that results are
+  // reproducible regardless of the number of threads
+  RandomNumberEngine seed_engine(seed);
+  std::vector<typename RandomNumberEngine::result_type> seed_list(num_reads);
+  for (auto &&read_seed : seed_list) {
+    read_seed = seed_engine();
+  }
+
+  std::vector<graph::Spins> solutions(num_reads);
+  std::vector<double> energies(num_reads);
+
+#pragma omp parallel for schedule(guided) num_threads(num_threads)
+  for (std::int64_t i = 0; i < num_reads; i++) {
+    System read_system = system;
+    read_system.reset_spins(init_states[i]);
+    RandomNumberEngine rng(seed_list[i]);
+    algorithm::Algorithm<Updater>::run(read_system, rng, schedule_list);
+    solutions[i] = result::get_solution(read_system);
+    energies[i] = result::get_energy(read_system);
+  }
+
+  return std::make_pair(std::move(solutions), std::move(energies));
+}
+
+template <template <typename> class Updater, typename System,
+          typename RandomNumberEngine, typename InitState>
+inline void declare_Algorithm_run_batch(py::module &m,
+                                        const std::string &updater_str) {
+  auto str = std::string("Algorithm_") + updater_str + std::string("_run_batch");
+  using SystemType = typename system::get_system_type<System>::type;
+  using TupleList = std::vector<std::pair<
+      typename utility::UpdaterParameter<SystemType>::Tuple, std::size_t>>;
+
+  // schedule_list
+  m.def(
+      str.c_str(),
+      [](const System &system, const std::vector<InitState> &init_states,
+         const std::size_t seed,
+         const utility::ScheduleList<SystemType> &schedule_list,
+         const int num_threads) {
+        py::gil_scoped_release release;
+        return run_batch_impl<Updater, System, RandomNumberEngine>(
+            system, init_states, seed, schedule_list, num_threads);
+      },
+      "system"_a, "init_states"_a, "seed"_a, "schedule_list"_a,
+      "num_threads"_a = 1);
+
+  // schedule_list can be a list of tuples
+  m.def(
+      str.c_str(),
+      [](const System &system, const std::vector<InitState> &init_states,
+         const std::size_t seed, const TupleList &tuplelist,
+         const int num_threads) {
+        py::gil_scoped_release release;
+        return run_batch_impl<Updater, System, RandomNumberEngine>(
+            system, init_states, seed,
+            utility::make_schedule_list<SystemType>(tuplelist), num_threads);
+      },
+      "system"_a, "init_states"_a, "seed"_a, "tuplelist"_a,
+      "num_threads"_a = 1);
+}
+
 // utility
 template <typename SystemType>
 inline std::string repr_impl(const utility::UpdaterParameter<SystemType> &);
@@ -903,8 +1112,8 @@ void declare_BinaryPolynomialModel(py::module &m) {
    py_class.def("get_system_size", &BPM::GetSystemSize);
    py_class.def("get_index_list", &BPM::GetIndexList);
    py_class.def("get_index_map", &BPM::GetIndexMap);
-   py_class.def("get_key_value_list", &BPM::GetKeyValueList);
-   py_class.def("get_adjacency_list", &BPM::GetAdjacencyList);
+   py_class.def("get_key_value_list", &BPM::BuildKeyValueList);
+   py_class.def("get_adjacency_list", &BPM::BuildAdjacencyList);
    py_class.def("get_estimated_min_energy_difference", &BPM::GetEstimatedMinEnergyDifference);
    py_class.def("get_estimated_max_energy_difference", &BPM::GetEstimatedMaxEnergyDifference);
    py_class.def("calculate_energy", &BPM::CalculateEnergy);
@@ -925,8 +1134,8 @@ void declare_IsingPolynomialModel(py::module &m) {
    py_class.def("get_system_size", &IPM::GetSystemSize);
    py_class.def("get_index_list", &IPM::GetIndexList);
    py_class.def("get_index_map", &IPM::GetIndexMap);
-   py_class.def("get_key_value_list", &IPM::GetKeyValueList);
-   py_class.def("get_adjacency_list", &IPM::GetAdjacencyList);
+   py_class.def("get_key_value_list", &IPM::BuildKeyValueList);
+   py_class.def("get_adjacency_list", &IPM::BuildAdjacencyList);
    py_class.def("get_estimated_min_energy_difference", &IPM::GetEstimatedMinEnergyDifference);
    py_class.def("get_estimated_max_energy_difference", &IPM::GetEstimatedMaxEnergyDifference);
    py_class.def("calculate_energy", &IPM::CalculateEnergy);
@@ -946,7 +1155,7 @@ void declare_IntegerQuadraticModel(py::module &m) {
    py_class.def("get_max_min_terms", &IQM::GetMaxMinTerms);
    py_class.def("get_index_list", &IQM::GetIndexList);
    py_class.def("get_num_variables", &IQM::GetNumVariables);
-   py_class.def("get_quadratic", &IQM::GetQuadratic);
+   py_class.def("get_quadratic", &IQM::BuildQuadratic);
    py_class.def("get_linear", &IQM::GetLinear);
    py_class.def("get_squared", &IQM::GetSquared);
    py_class.def("get_constant", &IQM::GetConstant);
@@ -983,20 +1192,68 @@ void declare_IntegerSAResult(py::module &m) {
     py_result.def_readonly("temperature_history", &sampler::IntegerSAResult::temperature_history);
 }
 
+void declare_IntegerSASampleSet(py::module &m) {
+    using ISS = sampler::IntegerSASampleSet;
+    auto py_sample_set = py::class_<ISS>(m, "IntegerSASampleSet", py::module_local());
+    py_sample_set.def_property_readonly("solutions", [](const ISS &self) {
+        const py::ssize_t num_variables = self.num_variables;
+        const py::ssize_t num_samples = num_variables > 0 ? self.solution_buffer->size()/num_variables : self.energies.size();
+        return to_numpy_array<std::int64_t>(self.solution_buffer, {num_samples, num_variables});
+    });
+    py_sample_set.def_property_readonly("energies", [](const ISS &self) {
+        return to_numpy_array(std::vector<double>(self.energies));
+    });
+    py_sample_set.def_readonly("energy_history", &ISS::energy_history);
+    py_sample_set.def_readonly("temperature_history", &ISS::temperature_history);
+}
+
 void declare_SampleByIntegerSA(py::module &m) {
     // SampleByIntegerSA for IntegerQuadraticModel
     m.def("sample_by_integer_sa_quadratic", 
           &sampler::SampleByIntegerSA<graph::IntegerQuadraticModel>,
           "model"_a, "num_sweeps"_a, "update_method"_a, "rand_type"_a,
           "schedule"_a, "num_reads"_a, "seed"_a, "num_threads"_a, 
-          "min_T"_a, "max_T"_a, "log_history"_a);
+          "min_T"_a, "max_T"_a, "log_history"_a,
+          "time_limit"_a = std::numeric_limits<double>::infinity(),
+          "target_energy"_a = -std::numeric_limits<double>::infinity(),
+          "beta_list"_a = std::vector<double>{},
+          "graph_coloring"_a = false, "fast_acceptance"_a = false,
+          "power_law_exponent"_a = 2.0, "plateau_ratio"_a = 0.5);
 
     // SampleByIntegerSA for IntegerPolynomialModel
     m.def("sample_by_integer_sa_polynomial", 
           &sampler::SampleByIntegerSA<graph::IntegerPolynomialModel>,
           "model"_a, "num_sweeps"_a, "update_method"_a, "rand_type"_a,
           "schedule"_a, "num_reads"_a, "seed"_a, "num_threads"_a, 
-          "min_T"_a, "max_T"_a, "log_history"_a);
+          "min_T"_a, "max_T"_a, "log_history"_a,
+          "time_limit"_a = std::numeric_limits<double>::infinity(),
+          "target_energy"_a = -std::numeric_limits<double>::infinity(),
+          "beta_list"_a = std::vector<double>{},
+          "graph_coloring"_a = false, "fast_acceptance"_a = false,
+          "power_law_exponent"_a = 2.0, "plateau_ratio"_a = 0.5);
+
+    // SampleSetByIntegerSA, which returns the solutions in one contiguous buffer
+    m.def("sample_set_by_integer_sa_quadratic", 
+          &sampler::SampleSetByIntegerSA<graph::IntegerQuadraticModel>,
+          "model"_a, "num_sweeps"_a, "update_method"_a, "rand_type"_a,
+          "schedule"_a, "num_reads"_a, "seed"_a, "num_threads"_a, 
+          "min_T"_a, "max_T"_a, "log_history"_a,
+          "time_limit"_a = std::numeric_limits<double>::infinity(),
+          "target_energy"_a = -std::numeric_limits<double>::infinity(),
+          "beta_list"_a = std::vector<double>{},
+          "graph_coloring"_a = false, "fast_acceptance"_a = false,
+          "power_law_exponent"_a = 2.0, "plateau_ratio"_a = 0.5);
+
+    m.def("sample_set_by_integer_sa_polynomial", 
+          &sampler::SampleSetByIntegerSA<graph::IntegerPolynomialModel>,
+          "model"_a, "num_sweeps"_a, "update_method"_a, "rand_type"_a,
+          "schedule"_a, "num_reads"_a, "seed"_a, "num_threads"_a, 
+          "min_T"_a, "max_T"_a, "log_history"_a,
+          "time_limit"_a = std::numeric_limits<double>::infinity(),
+          "target_energy"_a = -std::numeric_limits<double>::infinity(),
+          "beta_list"_a = std::vector<double>{},
+          "graph_coloring"_a = false, "fast_acceptance"_a = false,
+          "power_law_exponent"_a = 2.0, "plateau_ratio"_a = 0.5);
 }
 
 
@@ -1020,6 +1277,18 @@ void declare_SASampler(py::module &m, const std::string &post_name = "") {
    py_class.def("set_update_method", &SAS::SetUpdateMethod, "update_method"_a);
    py_class.def("set_random_number_engine", &SAS::SetRandomNumberEngine, "random_number_engine"_a);
    py_class.def("set_temperature_schedule", &SAS::SetTemperatureSchedule, "temperature_schedule"_a);
+   py_class.def("set_power_law_exponent", &SAS::SetPowerLawExponent, "exponent"_a);
+   py_class.def("set_plateau_ratio", &SAS::SetPlateauRatio, "plateau_ratio"_a);
+   py_class.def("set_replica_packing", &SAS::SetReplicaPacking, "replica_packing"_a);
+   py_class.def("set_fast_acceptance", &SAS::SetFastAcceptance, "fast_acceptance"_a);
+   py_class.def("set_graph_coloring", &SAS::SetGraphColoring, "graph_coloring"_a);
+   py_class.def("set_aggregate_samples", &SAS::SetAggregateSamples, "aggregate_samples"_a);
+   py_class.def("set_initial_states", &SAS::SetInitialStates, "initial_states"_a);
+   py_class.def("set_beta_list", py::overload_cast<const std::vector<typename ModelType::ValueType>&>(&SAS::SetBetaList), "beta_list"_a);
+   py_class.def("set_beta_list", py::overload_cast<const std::vector<typename ModelType::ValueType>&, const std::vector<std::int32_t>&>(&SAS::SetBetaList), "beta_list"_a, "num_repeats_list"_a);
+   py_class.def("set_energy_check", &SAS::SetEnergyCheck, "energy_check"_a);
+   py_class.def("set_time_limit", &SAS::SetTimeLimit, "time_limit"_a);
+   py_class.def("set_target_energy", &SAS::SetTargetEnergy, "target_energy"_a);
    py_class.def("get_model", &SAS::GetModel);
    py_class.def("get_num_sweeps", &SAS::GetNumSweeps);
    py_class.def("get_num_reads", &SAS::GetNumReads);
@@ -1029,10 +1298,32 @@ void declare_SASampler(py::module &m, const std::string &post_name = "") {
    py_class.def("get_update_method", &SAS::GetUpdateMethod);
    py_class.def("get_random_number_engine", &SAS::GetRandomNumberEngine);
    py_class.def("get_temperature_schedule", &SAS::GetTemperatureSchedule);
+   py_class.def("get_power_law_exponent", &SAS::GetPowerLawExponent);
+   py_class.def("get_plateau_ratio", &SAS::GetPlateauRatio);
+   py_class.def("get_replica_packing", &SAS::GetReplicaPacking);
+   py_class.def("get_fast_acceptance", &SAS::GetFastAcceptance);
+   py_class.def("get_graph_coloring", &SAS::GetGraphColoring);
+   py_class.def("get_aggregate_samples", &SAS::GetAggregateSamples);
+   py_class.def("get_initial_states", &SAS::GetInitialStates);
+   py_class.def("get_beta_list", &SAS::GetBetaList);
+   py_class.def("get_energy_check", &SAS::GetEnergyCheck);
+   py_class.def("get_time_limit", &SAS::GetTimeLimit);
+   py_class.def("get_target_energy", &SAS::GetTargetEnergy);
    py_class.def("get_seed", &SAS::GetSeed);
    py_class.def("get_index_list", &SAS::GetIndexList);
    py_class.def("get_samples", &SAS::GetSamples);
+   py_class.def("get_num_samples", &SAS::GetNumSamples);
+   py_class.def("get_sample_array", [](const SAS &self) {
+      const py::ssize_t system_size = self.GetModel().GetSystemSize();
+      return to_numpy_array(self.GetSampleBuffer(), {self.GetNumSamples(), system_size});
+   });
+   py_class.def("get_num_occurrences", [](const SAS &self) {
+      return to_numpy_array(self.GetNumOccurrences());
+   });
    py_class.def("calculate_energies", &SAS::CalculateEnergies);
+   py_class.def("calculate_energy_array", [](const SAS &self) {
+      return to_numpy_array(self.CalculateEnergies());
+   });
    py_class.def("sample", py::overload_cast<>(&SAS::Sample));
    py_class.def("sample", py::overload_cast<const std::uint64_t>(&SAS::Sample), "seed"_a);
 
@@ -1042,25 +1333,127 @@ void declare_SASampler(py::module &m, const std::string &post_name = "") {
 
 }
 
+template<class ModelType>
+void declare_PTSampler(py::module &m, const std::string &post_name = "") {
+   using PTS = sampler::PTSampler<ModelType>;
+   
+   std::string name = std::string("PTSampler") + post_name;
+
+   auto py_class = py::class_<PTS>(m, name.c_str(), py::module_local());
+
+   py_class.def(py::init<const ModelType&>(), "model"_a);
+
+   py_class.def("set_num_sweeps", &PTS::SetNumSweeps, "num_sweeps"_a);
+   py_class.def("set_num_reads", &PTS::SetNumReads, "num_reads"_a);
+   py_class.def("set_num_replicas", &PTS::SetNumReplicas, "num_replicas"_a);
+   py_class.def("set_exchange_interval", &PTS::SetExchangeInterval, "exchange_interval"_a);
+   py_class.def("set_num_threads", &PTS::SetNumThreads, "num_threads"_a);
+   py_class.def("set_beta_min", &PTS::SetBetaMin, "beta_min"_a);
+   py_class.def("set_beta_max", &PTS::SetBetaMax, "beta_max"_a);
+   py_class.def("set_beta_min_auto", &PTS::SetBetaMinAuto);
+   py_class.def("set_beta_max_auto", &PTS::SetBetaMaxAuto);
+   py_class.def("set_update_method", &PTS::SetUpdateMethod, "update_method"_a);
+   py_class.def("set_random_number_engine", &PTS::SetRandomNumberEngine, "random_number_engine"_a);
+   py_class.def("set_adaptive_ladder", &PTS::SetAdaptiveLadder, "adaptive_ladder"_a);
+   py_class.def("set_fast_acceptance", &PTS::SetFastAcceptance, "fast_acceptance"_a);
+   py_class.def("get_model", &PTS::GetModel);
+   py_class.def("get_num_sweeps", &PTS::GetNumSweeps);
+   py_class.def("get_num_reads", &PTS::GetNumReads);
+   py_class.def("get_num_replicas", &PTS::GetNumReplicas);
+   py_class.def("get_exchange_interval", &PTS::GetExchangeInterval);
+   py_class.def("get_num_threads", &PTS::GetNumThreads);
+   py_class.def("get_beta_min", &PTS::GetBetaMin);
+   py_class.def("get_beta_max", &PTS::GetBetaMax);
+   py_class.def("get_update_method", &PTS::GetUpdateMethod);
+   py_class.def("get_random_number_engine", &PTS::GetRandomNumberEngine);
+   py_class.def("get_adaptive_ladder", &PTS::GetAdaptiveLadder);
+   py_class.def("get_fast_acceptance", &PTS::GetFastAcceptance);
+   py_class.def("get_seed", &PTS::GetSeed);
+   py_class.def("get_index_list", &PTS::GetIndexList);
+   py_class.def("get_beta_list", &PTS::GetBetaList);
+   py_class.def("get_exchange_acceptance_rates", &PTS::GetExchangeAcceptanceRates);
+   py_class.def("get_samples", &PTS::GetSamples);
+   py_class.def("calculate_energies", &PTS::CalculateEnergies);
+   py_class.def("sample", py::overload_cast<>(&PTS::Sample));
+   py_class.def("sample", py::overload_cast<const std::uint64_t>(&PTS::Sample), "seed"_a);
+
+   m.def("make_pt_sampler", [](const ModelType &model) {
+      return sampler::make_pt_sampler(model);
+   }, "model"_a);
+
+}
+
+template<typename FloatType>
+void declare_HoudayerPTSampler(py::module &m) {
+   using HPTS = sampler::HoudayerPTSampler<FloatType>;
+
+   auto py_class = py::class_<HPTS>(m, "HoudayerPTSampler", py::module_local());
+
+   py_class.def(py::init<const graph::CSRSparse<FloatType>&>(), "graph"_a);
+   py_class.def(py::init<const graph::Sparse<FloatType>&>(), "graph"_a);
+
+   py_class.def("set_num_sweeps", &HPTS::SetNumSweeps, "num_sweeps"_a);
+   py_class.def("set_num_reads", &HPTS::SetNumReads, "num_reads"_a);
+   py_class.def("set_num_temperatures", &HPTS::SetNumTemperatures, "num_temperatures"_a);
+   py_class.def("set_exchange_interval", &HPTS::SetExchangeInterval, "exchange_interval"_a);
+   py_class.def("set_num_threads", &HPTS::SetNumThreads, "num_threads"_a);
+   py_class.def("set_beta_min", &HPTS::SetBetaMin, "beta_min"_a);
+   py_class.def("set_beta_max", &HPTS::SetBetaMax, "beta_max"_a);
+   py_class.def("set_houdayer_beta_min", &HPTS::SetHoudayerBetaMin, "houdayer_beta_min"_a);
+   py_class.def("set_random_number_engine", &HPTS::SetRandomNumberEngine, "random_number_engine"_a);
+   py_class.def("get_graph", &HPTS::GetGraph);
+   py_class.def("get_num_sweeps", &HPTS::GetNumSweeps);
+   py_class.def("get_num_reads", &HPTS::GetNumReads);
+   py_class.def("get_num_temperatures", &HPTS::GetNumTemperatures);
+   py_class.def("get_exchange_interval", &HPTS::GetExchangeInterval);
+   py_class.def("get_num_threads", &HPTS::GetNumThreads);
+   py_class.def("get_beta_min", &HPTS::GetBetaMin);
+   py_class.def("get_beta_max", &HPTS::GetBetaMax);
+   py_class.def("get_houdayer_beta_min", &HPTS::GetHoudayerBetaMin);
+   py_class.def("get_random_number_engine", &HPTS::GetRandomNumberEngine);
+   py_class.def("get_seed", &HPTS::GetSeed);
+   py_class.def("get_beta_list", &HPTS::GetBetaList);
+   py_class.def("get_exchange_acceptance_rates", &HPTS::GetExchangeAcceptanceRates);
+   py_class.def("get_mean_cluster_sizes", &HPTS::GetMeanClusterSizes);
+   py_class.def("get_samples", &HPTS::GetSamples);
+   py_class.def("calculate_energies", &HPTS::CalculateEnergies);
+   py_class.def("sample", py::overload_cast<>(&HPTS::Sample));
+   py_class.def("sample", py::overload_cast<const std::uint64_t>(&HPTS::Sample), "seed"_a);
+
+   m.def("make_houdayer_pt_sampler", [](const graph::CSRSparse<FloatType> &graph) {
+      return sampler::make_houdayer_pt_sampler(graph);
+   }, "graph"_a);
+   m.def("make_houdayer_pt_sampler", [](const graph::Sparse<FloatType> &graph) {
+      return sampler::make_houdayer_pt_sampler(graph);
+   }, "graph"_a);
+
+}
+
 void declare_UpdateMethod(py::module &m) {
    py::enum_<algorithm::UpdateMethod>(m, "UpdateMethod")
       .value("METROPOLIS", algorithm::UpdateMethod::METROPOLIS)
       .value("HEAT_BATH", algorithm::UpdateMethod::HEAT_BATH)
       .value("SUWA_TODO", algorithm::UpdateMethod::SUWA_TODO)
-      .value("OPT_METROPOLIS", algorithm::UpdateMethod::OPT_METROPOLIS);
+      .value("OPT_METROPOLIS", algorithm::UpdateMethod::OPT_METROPOLIS)
+      .value("REJECTION_FREE", algorithm::UpdateMethod::REJECTION_FREE);
 }
 
 void declare_RandomNumberEngine(py::module &m) {
    py::enum_<algorithm::RandomNumberEngine>(m, "RandomNumberEngine")
       .value("MT", algorithm::RandomNumberEngine::MT)
       .value("MT_64", algorithm::RandomNumberEngine::MT_64)
+      .value("PHILOX", algorithm::RandomNumberEngine::PHILOX)
+      .value("XOSHIRO", algorithm::RandomNumberEngine::XOSHIRO)
+      .value("PCG64", algorithm::RandomNumberEngine::PCG64)
       .value("XORSHIFT", algorithm::RandomNumberEngine::XORSHIFT);
 }
 
 void declare_TemperatureSchedule(py::module &m) {
    py::enum_<utility::TemperatureSchedule>(m, "TemperatureSchedule")
       .value("LINEAR", utility::TemperatureSchedule::LINEAR)
-      .value("GEOMETRIC", utility::TemperatureSchedule::GEOMETRIC);
+      .value("GEOMETRIC", utility::TemperatureSchedule::GEOMETRIC)
+      .value("POWER_LAW", utility::TemperatureSchedule::POWER_LAW)
+      .value("EXPONENTIAL_PLATEAU", utility::TemperatureSchedule::EXPONENTIAL_PLATEAU);
 }
 
 
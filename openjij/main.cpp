@@ -55,8 +55,12 @@ PYBIND11_MODULE(cxxjij, m) {
 
   py::module_ m_sampler = m.def_submodule("sampler");
   openjij::declare_IntegerSAResult(m_sampler);
+  openjij::declare_IntegerSASampleSet(m_sampler);
   openjij::declare_SASampler<openjij::graph::BinaryPolynomialModel<openjij::FloatType>>(m_sampler, "BPM");
   openjij::declare_SASampler<openjij::graph::IsingPolynomialModel<openjij::FloatType>>(m_sampler, "IPM");
+  openjij::declare_PTSampler<openjij::graph::BinaryPolynomialModel<openjij::FloatType>>(m_sampler, "BPM");
+  openjij::declare_PTSampler<openjij::graph::IsingPolynomialModel<openjij::FloatType>>(m_sampler, "IPM");
+  openjij::declare_HoudayerPTSampler<openjij::FloatType>(m_sampler);
   openjij::declare_SampleByIntegerSA(m_sampler);
 
   /**********************************************************
@@ -71,6 +75,14 @@ PYBIND11_MODULE(cxxjij, m) {
       m_system, "_Sparse");
   openjij::declare_ClassicalIsing<openjij::graph::CSRSparse<openjij::FloatType>>(
       m_system, "_CSRSparse");
+  openjij::declare_CompactClassicalIsing<
+      openjij::graph::Dense<openjij::FloatType>, float>(
+      m_system, "_Dense", "make_compact_classical_ising");
+  openjij::declare_CompactClassicalIsing<
+      openjij::graph::Dense<openjij::FloatType>, openjij::utility::BFloat16>(
+      m_system, "_BFloat16_Dense", "make_compact_classical_ising_bfloat16");
+  openjij::declare_ReplicaPackedClassicalIsing<
+      openjij::graph::Dense<openjij::FloatType>>(m_system, "_Dense");
   openjij::declare_ClassicalIsingPolynomial<
       openjij::graph::Polynomial<openjij::FloatType>>(m_system, "_Polynomial");
   openjij::declare_KLocalPolynomial<
@@ -141,6 +153,82 @@ PYBIND11_MODULE(cxxjij, m) {
           openjij::graph::CSRSparse<openjij::FloatType>>,
       openjij::RandomEngine>(m_algorithm, "SingleSpinFlip");
 
+  // singlespinflip with the compact dense storage
+  openjij::declare_Algorithm_run<
+      openjij::updater::SingleSpinFlip,
+      openjij::system::CompactClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>, float>,
+      openjij::RandomEngine>(m_algorithm, "SingleSpinFlip");
+  openjij::declare_Algorithm_run<
+      openjij::updater::SingleSpinFlip,
+      openjij::system::CompactClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>, openjij::utility::BFloat16>,
+      openjij::RandomEngine>(m_algorithm, "SingleSpinFlip");
+  openjij::declare_Algorithm_run<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::CompactClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>, float>,
+      openjij::RandomEngine>(m_algorithm, "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::CompactClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>, openjij::utility::BFloat16>,
+      openjij::RandomEngine>(m_algorithm, "FastSingleSpinFlip");
+
+  // singlespinflip over the replicas packed into one system
+  openjij::declare_Algorithm_run<
+      openjij::updater::SingleSpinFlip,
+      openjij::system::ReplicaPackedClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>>,
+      openjij::RandomEngine>(m_algorithm, "SingleSpinFlip");
+  openjij::declare_Algorithm_run<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::ReplicaPackedClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>>,
+      openjij::RandomEngine>(m_algorithm, "FastSingleSpinFlip");
+
+  // singlespinflip with the fast acceptance test
+  openjij::declare_Algorithm_run<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::ClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>>,
+      openjij::RandomEngine>(m_algorithm, "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::ClassicalIsing<
+          openjij::graph::Sparse<openjij::FloatType>>,
+      openjij::RandomEngine>(m_algorithm, "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::ClassicalIsing<
+          openjij::graph::CSRSparse<openjij::FloatType>>,
+      openjij::RandomEngine>(m_algorithm, "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::TransverseIsing<
+          openjij::graph::Dense<openjij::FloatType>>,
+      openjij::RandomEngine>(m_algorithm, "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::TransverseIsing<
+          openjij::graph::Sparse<openjij::FloatType>>,
+      openjij::RandomEngine>(m_algorithm, "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::TransverseIsing<
+          openjij::graph::CSRSparse<openjij::FloatType>>,
+      openjij::RandomEngine>(m_algorithm, "FastSingleSpinFlip");
+
+  // singlespinflip updating the spins of each color in parallel
+  openjij::declare_ColoredSingleSpinFlip_run<
+      openjij::system::ClassicalIsing<
+          openjij::graph::Sparse<openjij::FloatType>>,
+      openjij::RandomEngine>(m_algorithm);
+  openjij::declare_ColoredSingleSpinFlip_run<
+      openjij::system::ClassicalIsing<
+          openjij::graph::CSRSparse<openjij::FloatType>>,
+      openjij::RandomEngine>(m_algorithm);
+
   // swendsen-wang
   openjij::declare_Algorithm_run<
       openjij::updater::SwendsenWang,
@@ -153,6 +241,138 @@ PYBIND11_MODULE(cxxjij, m) {
           openjij::graph::CSRSparse<openjij::FloatType>>,
       openjij::RandomEngine>(m_algorithm, "SwendsenWang");
 
+  // wolff
+  openjij::declare_Algorithm_run<
+      openjij::updater::Wolff,
+      openjij::system::ClassicalIsing<
+          openjij::graph::Sparse<openjij::FloatType>>,
+      openjij::RandomEngine>(m_algorithm, "Wolff");
+  openjij::declare_Algorithm_run<
+      openjij::updater::Wolff,
+      openjij::system::ClassicalIsing<
+          openjij::graph::CSRSparse<openjij::FloatType>>,
+      openjij::RandomEngine>(m_algorithm, "Wolff");
+
+  // batch of independent reads (singlespinflip, swendsen-wang, wolff)
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::SingleSpinFlip,
+      openjij::system::ClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm,
+                                                    "SingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::SingleSpinFlip,
+      openjij::system::ClassicalIsing<
+          openjij::graph::Sparse<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm,
+                                                    "SingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::SingleSpinFlip,
+      openjij::system::ClassicalIsing<
+          openjij::graph::CSRSparse<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm,
+                                                    "SingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::SingleSpinFlip,
+      openjij::system::TransverseIsing<
+          openjij::graph::Dense<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::system::TrotterSpins>(m_algorithm,
+                                                            "SingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::SingleSpinFlip,
+      openjij::system::TransverseIsing<
+          openjij::graph::Sparse<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::system::TrotterSpins>(m_algorithm,
+                                                            "SingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::SingleSpinFlip,
+      openjij::system::TransverseIsing<
+          openjij::graph::CSRSparse<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::system::TrotterSpins>(m_algorithm,
+                                                            "SingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::ClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm,
+                                                    "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::ClassicalIsing<
+          openjij::graph::Sparse<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm,
+                                                    "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::ClassicalIsing<
+          openjij::graph::CSRSparse<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm,
+                                                    "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::TransverseIsing<
+          openjij::graph::Dense<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::system::TrotterSpins>(m_algorithm,
+                                                            "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::TransverseIsing<
+          openjij::graph::Sparse<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::system::TrotterSpins>(m_algorithm,
+                                                            "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::TransverseIsing<
+          openjij::graph::CSRSparse<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::system::TrotterSpins>(m_algorithm,
+                                                            "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::SingleSpinFlip,
+      openjij::system::CompactClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>, float>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm,
+                                                    "SingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::SingleSpinFlip,
+      openjij::system::CompactClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>, openjij::utility::BFloat16>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm,
+                                                    "SingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::CompactClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>, float>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm,
+                                                    "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::FastSingleSpinFlip,
+      openjij::system::CompactClassicalIsing<
+          openjij::graph::Dense<openjij::FloatType>, openjij::utility::BFloat16>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm,
+                                                    "FastSingleSpinFlip");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::SwendsenWang,
+      openjij::system::ClassicalIsing<
+          openjij::graph::Sparse<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm,
+                                                    "SwendsenWang");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::SwendsenWang,
+      openjij::system::ClassicalIsing<
+          openjij::graph::CSRSparse<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm,
+                                                    "SwendsenWang");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::Wolff,
+      openjij::system::ClassicalIsing<
+          openjij::graph::Sparse<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm, "Wolff");
+  openjij::declare_Algorithm_run_batch<
+      openjij::updater::Wolff,
+      openjij::system::ClassicalIsing<
+          openjij::graph::CSRSparse<openjij::FloatType>>,
+      openjij::RandomEngine, openjij::graph::Spins>(m_algorithm, "Wolff");
+
   // Continuous time swendsen-wang
   openjij::declare_Algorithm_run<
       openjij::updater::ContinuousTimeSwendsenWang,
@@ -210,6 +430,13 @@ PYBIND11_MODULE(cxxjij, m) {
       openjij::graph::Sparse<openjij::FloatType>>>(m_result);
   openjij::declare_get_solution<openjij::system::ClassicalIsing<
       openjij::graph::CSRSparse<openjij::FloatType>>>(m_result);
+  openjij::declare_get_solution<openjij::system::CompactClassicalIsing<
+      openjij::graph::Dense<openjij::FloatType>, float>>(m_result);
+  openjij::declare_get_solution<openjij::system::CompactClassicalIsing<
+      openjij::graph::Dense<openjij::FloatType>, openjij::utility::BFloat16>>(
+      m_result);
+  openjij::declare_get_solution<openjij::system::ReplicaPackedClassicalIsing<
+      openjij::graph::Dense<openjij::FloatType>>>(m_result);
   openjij::declare_get_solution<openjij::system::ClassicalIsingPolynomial<
       openjij::graph::Polynomial<openjij::FloatType>>>(m_result);
   openjij::declare_get_solution<openjij::system::KLocalPolynomial<
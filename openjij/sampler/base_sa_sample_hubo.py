@@ -2,6 +2,7 @@ from __future__ import annotations
 from typing import Optional, Union
 
 import time
+import numpy as np
 from openjij.sampler.response import Response
 from openjij.variable_type import BINARY, SPIN
 from openjij.cxxjij.graph import (
@@ -12,21 +13,52 @@ from openjij.cxxjij.sampler import make_sa_sampler
 from openjij.utils.cxx_cast import (
     cast_to_cxx_update_method,
     cast_to_cxx_random_number_engine,
-    cast_to_cxx_temperature_schedule
+    cast_to_cxx_temperature_schedule,
+    cast_to_cxx_beta_schedule
 )
 
 def to_oj_response(
-    variables: list[list[Union[int, float]]], 
+    variables: Union[list[list[Union[int, float]]], np.ndarray], 
     index_list: list[Union[int, str, tuple[int, ...]]],
-    energies: list[float], 
-    vartype: str
+    energies: Union[list[float], np.ndarray], 
+    vartype: str,
+    num_occurrences: Optional[np.ndarray] = None,
 ) -> Response:
+    if isinstance(variables, np.ndarray):
+        # A (num_reads x num_variables) array is passed as is without making a dict per sample
+        return Response.from_samples(
+            samples_like=(variables, index_list),
+            vartype=vartype,
+            energy=energies,
+            num_occurrences=num_occurrences,
+        )
     return Response.from_samples(
         samples_like=[dict(zip(index_list, v_list)) for v_list in variables], 
         vartype=vartype, 
         energy=energies
     )  
 
+def to_cxx_initial_states(
+    initial_states: Union[dict, list[dict], np.ndarray],
+    index_list: list[Union[int, str, tuple[int, ...]]],
+) -> list[list[int]]:
+    # A dict or a list of dicts maps the variables to their values,
+    # and the rows of an array are in the order of the index list
+    if isinstance(initial_states, dict):
+        initial_states = [initial_states]
+    if isinstance(initial_states, np.ndarray):
+        initial_states = np.atleast_2d(initial_states).tolist()
+    cxx_initial_states = []
+    for state in initial_states:
+        if isinstance(state, dict):
+            try:
+                cxx_initial_states.append([int(state[index]) for index in index_list])
+            except KeyError as e:
+                raise ValueError(f"The initial state lacks the variable {e}.")
+        else:
+            cxx_initial_states.append([int(v) for v in state])
+    return cxx_initial_states
+
 def base_sample_hubo(
     hubo: dict[tuple, float],
     vartype: Optional[str] = None,
@@ -39,6 +71,16 @@ def base_sample_hubo(
     random_number_engine: str = "XORSHIFT",
     seed: Optional[int] = None,
     temperature_schedule: str = "GEOMETRIC",
+    replica_packing: bool = False,
+    fast_acceptance: bool = False,
+    time_limit: Optional[float] = None,
+    target_energy: Optional[float] = None,
+    aggregate_samples: bool = False,
+    initial_states: Optional[Union[dict, list[dict], np.ndarray]] = None,
+    beta_schedule: Optional[Union[list[float], list[tuple[float, int]], np.ndarray]] = None,
+    power_law_exponent: Optional[float] = None,
+    plateau_ratio: Optional[float] = None,
+    graph_coloring: bool = False,
 ) -> Response:
     
     start_time = time.time()
@@ -75,6 +117,25 @@ def base_sample_hubo(
     sampler.set_temperature_schedule(
         temperature_schedule=cast_to_cxx_temperature_schedule(temperature_schedule)
     )
+    sampler.set_replica_packing(replica_packing=replica_packing)
+    sampler.set_fast_acceptance(fast_acceptance=fast_acceptance)
+    sampler.set_graph_coloring(graph_coloring=graph_coloring)
+    sampler.set_aggregate_samples(aggregate_samples=aggregate_samples)
+    if time_limit is not None:
+        sampler.set_time_limit(time_limit=time_limit)
+    if target_energy is not None:
+        sampler.set_target_energy(target_energy=target_energy)
+    if initial_states is not None:
+        sampler.set_initial_states(
+            initial_states=to_cxx_initial_states(initial_states, sampler.get_index_list())
+        )
+    if beta_schedule is not None:
+        beta_list, num_repeats_list = cast_to_cxx_beta_schedule(beta_schedule)
+        sampler.set_beta_list(beta_list=beta_list, num_repeats_list=num_repeats_list)
+    if power_law_exponent is not None:
+        sampler.set_power_law_exponent(exponent=power_law_exponent)
+    if plateau_ratio is not None:
+        sampler.set_plateau_ratio(plateau_ratio=plateau_ratio)
 
     if beta_min is not None:
         sampler.set_beta_min(beta_min=beta_min)
@@ -98,10 +159,11 @@ def base_sample_hubo(
     # Make openjij response
     start_make_oj_response = time.time()
     response = to_oj_response(
-        sampler.get_samples(), 
+        sampler.get_sample_array(), 
         sampler.get_index_list(),
-        sampler.calculate_energies(),
-        vartype
+        sampler.calculate_energy_array(),
+        vartype,
+        sampler.get_num_occurrences() if aggregate_samples else None,
     )
     make_oj_response_time = time.time() - start_make_oj_response
 
@@ -114,6 +176,14 @@ def base_sample_hubo(
         "update_method": update_method,
         "random_number_engine": random_number_engine,
         "temperature_schedule": temperature_schedule,
+        "replica_packing": replica_packing,
+        "fast_acceptance": fast_acceptance,
+        "graph_coloring": graph_coloring,
+        "time_limit": time_limit,
+        "target_energy": target_energy,
+        "aggregate_samples": aggregate_samples,
+        "warm_start": initial_states is not None,
+        "beta_schedule": "custom schedule" if beta_schedule is not None else temperature_schedule,
         "seed": sampler.get_seed(),
     }
 
@@ -32,7 +32,8 @@ from openjij.sampler.base_sa_sample_hubo import base_sample_hubo, to_oj_response
 from openjij.utils.cxx_cast import (
     cast_to_cxx_update_method,
     cast_to_cxx_random_number_engine,
-    cast_to_cxx_temperature_schedule
+    cast_to_cxx_temperature_schedule,
+    cast_to_cxx_beta_schedule
 )
 
 
@@ -99,11 +100,24 @@ class SASampler(BaseSampler):
             "singlespinflip": cxxjij.system.make_classical_ising,
             "singlespinflippolynomial": cxxjij.system.make_classical_ising_polynomial,
             "swendsenwang": cxxjij.system.make_classical_ising,
+            "wolff": cxxjij.system.make_classical_ising,
         }
         self._algorithm = {
             "singlespinflip": cxxjij.algorithm.Algorithm_SingleSpinFlip_run,
             "singlespinflippolynomial": cxxjij.algorithm.Algorithm_SingleSpinFlip_run,
             "swendsenwang": cxxjij.algorithm.Algorithm_SwendsenWang_run,
+            "wolff": cxxjij.algorithm.Algorithm_Wolff_run,
+        }
+        self._batch_algorithm = {
+            "singlespinflip": cxxjij.algorithm.Algorithm_SingleSpinFlip_run_batch,
+            "swendsenwang": cxxjij.algorithm.Algorithm_SwendsenWang_run_batch,
+            "wolff": cxxjij.algorithm.Algorithm_Wolff_run_batch,
+        }
+        self._fast_algorithm = {
+            "singlespinflip": cxxjij.algorithm.Algorithm_FastSingleSpinFlip_run,
+        }
+        self._fast_batch_algorithm = {
+            "singlespinflip": cxxjij.algorithm.Algorithm_FastSingleSpinFlip_run_batch,
         }
 
     def _convert_validation_schedule(self, schedule):
@@ -149,6 +163,10 @@ class SASampler(BaseSampler):
         sparse: Optional[bool] = None,
         reinitialize_state: Optional[bool] = None,
         seed: Optional[int] = None,
+        num_threads: int = 1,
+        fast_acceptance: bool = False,
+        graph_coloring: bool = False,
+        dense_precision: str = "float64",
     ) -> "oj.sampler.response.Response":
         """Sample Ising model.
 
@@ -160,10 +178,14 @@ class SASampler(BaseSampler):
             num_reads (int): number of reads
             schedule (list): list of inverse temperature
             initial_state (dict): initial state
-            updater(str): updater algorithm
+            updater(str): updater algorithm, "single spin flip", "swendsen wang", or "wolff"
             sparse (bool): use sparse matrix or not.
             reinitialize_state (bool): if true reinitialize state for each run
             seed (int): seed for Monte Carlo algorithm
+            num_threads (int): number of threads. Parallelized for each sampling with num_reads > 1 when reinitialize_state is True. Defaults to 1.
+            fast_acceptance (bool): if true, the acceptance test of single spin flip uses fast exp and skips hopeless moves. Defaults to False.
+            graph_coloring (bool): if true, the spins of each color of the interaction graph are updated in parallel by num_threads threads within a read, and the reads are run one by one. Only the single spin flip on sparse models is supported. Defaults to False.
+            dense_precision (str): precision of the stored interactions of a dense model, "float64", "float32", or "bfloat16". With "float32" and "bfloat16", the spins are stored as int8 and the energy differences as float32, which halves or quarters the memory traffic of the single spin flip on large dense models. Defaults to "float64".
         Returns:
             :class:`openjij.sampler.response.Response`: results
 
@@ -192,8 +214,8 @@ class SASampler(BaseSampler):
             reinitialize_state = True
 
         _updater_name = updater.lower().replace("_", "").replace(" ", "")
-        # swendsen wang algorithm runs only on sparse ising graphs.
-        if _updater_name == "swendsenwang" or sparse:
+        # swendsen wang and wolff algorithms run only on sparse ising graphs.
+        if _updater_name in ("swendsenwang", "wolff") or sparse:
             sparse = True
         else:
             sparse = False
@@ -314,15 +336,58 @@ class SASampler(BaseSampler):
         # choose updater -------------------------------------------
         _updater_name = updater.lower().replace("_", "").replace(" ", "")
         if _updater_name not in self._make_system:
-            raise ValueError('updater is one of "single spin flip or swendsen wang"')
+            raise ValueError('updater is one of "single spin flip", "swendsen wang", or "wolff"')
         algorithm = self._algorithm[_updater_name]
-        sa_system = self._make_system[_updater_name](
-            _generate_init_state(), ising_graph
-        )
+        batch_algorithm = self._batch_algorithm.get(_updater_name)
+        if fast_acceptance and _updater_name in self._fast_algorithm:
+            algorithm = self._fast_algorithm[_updater_name]
+            batch_algorithm = self._fast_batch_algorithm[_updater_name]
+        if graph_coloring:
+            if _updater_name != "singlespinflip" or not sparse:
+                raise ValueError(
+                    "graph_coloring is supported only by the single spin flip on sparse models"
+                )
+            batch_algorithm = None
+        make_system = self._make_system[_updater_name]
+        if dense_precision != "float64":
+            if _updater_name != "singlespinflip" or sparse or graph_coloring:
+                raise ValueError(
+                    "dense_precision is supported only by the single spin flip on dense models"
+                )
+            if dense_precision == "float32":
+                make_system = cxxjij.system.make_compact_classical_ising
+            elif dense_precision == "bfloat16":
+                make_system = cxxjij.system.make_compact_classical_ising_bfloat16
+            else:
+                raise ValueError(
+                    'dense_precision is one of "float64", "float32", and "bfloat16"'
+                )
+        sa_system = make_system(_generate_init_state(), ising_graph)
+        if graph_coloring:
+            # the coloring is made once and shared by the reads
+            color_list = cxxjij.algorithm.generate_color_list(sa_system)
+
+            def algorithm(system, *args):
+                return cxxjij.algorithm.Algorithm_ColoredSingleSpinFlip_run(
+                    system, *args, color_list, num_threads
+                )
+
         # ------------------------------------------- choose updater
-        response = self._cxxjij_sampling(
-            model, _generate_init_state, algorithm, sa_system, reinitialize_state, seed
-        )
+        if reinitialize_state and batch_algorithm is not None:
+            response = self._cxxjij_batch_sampling(
+                model,
+                _generate_init_state,
+                batch_algorithm,
+                sa_system,
+                seed,
+                offset,
+                num_threads,
+                energy_graph=ising_graph if dense_precision != "float64" else None,
+            )
+        else:
+            response = self._cxxjij_sampling(
+                model, _generate_init_state, algorithm, sa_system, reinitialize_state, seed
+            )
 
         response.info["schedule"] = self.schedule_info
 
@@ -497,6 +562,16 @@ class SASampler(BaseSampler):
         random_number_engine: str = "XORSHIFT",
         seed: Optional[int] = None,
         temperature_schedule: str = "GEOMETRIC",
+        replica_packing: bool = False,
+        fast_acceptance: bool = False,
+        time_limit: Optional[float] = None,
+        target_energy: Optional[float] = None,
+        aggregate_samples: bool = False,
+        initial_states: Optional[Union[dict, list[dict], np.ndarray]] = None,
+        beta_schedule: Optional[Union[list[float], list[tuple[float, int]], np.ndarray]] = None,
+        power_law_exponent: Optional[float] = None,
+        plateau_ratio: Optional[float] = None,
+        graph_coloring: bool = False,
     ):  
         """Sampling from higher order unconstrained binary optimization.
 
@@ -508,10 +583,20 @@ class SASampler(BaseSampler):
             num_threads (int, optional): The number of threads. Parallelized for each sampling with num_reads > 1. Defaults to 1.
             beta_min (float, optional): Minimum beta (initial inverse temperature). Defaults to None.
             beta_max (float, optional): Maximum beta (final inverse temperature). Defaults to None.
-            updater (str, optional): Updater. One can choose "METROPOLIS", "HEAT_BATH", or "k-local". Defaults to "METROPOLIS".
-            random_number_engine (str, optional): Random number engine. One can choose "XORSHIFT", "MT", or "MT_64". Defaults to "XORSHIFT".            
+            updater (str, optional): Updater. One can choose "METROPOLIS", "HEAT_BATH", "REJECTION_FREE", or "k-local". "REJECTION_FREE" is the n-fold way version of the Metropolis update with random variable selection, which is efficient at low temperatures. Defaults to "METROPOLIS".
+            random_number_engine (str, optional): Random number engine. One can choose "XORSHIFT", "MT", "MT_64", "PHILOX", "XOSHIRO", or "PCG64". Defaults to "XORSHIFT".            
             seed (int, optional): seed for Monte Carlo algorithm. Defaults to None.
-            temperature_schedule (str, optional): Temperature schedule. One can choose "LINEAR", "GEOMETRIC". Defaults to "GEOMETRIC".
+            temperature_schedule (str, optional): Temperature schedule. One can choose "LINEAR", "GEOMETRIC", "POWER_LAW", or "EXPONENTIAL_PLATEAU". Defaults to "GEOMETRIC".
+            replica_packing (bool, optional): If True, up to 64 reads are bit-packed and updated at once. Defaults to False.
+            fast_acceptance (bool, optional): If True, the acceptance test uses fast exp and skips hopeless moves. Defaults to False.
+            time_limit (float, optional): Wall-clock time limit in seconds. Reads not started by the deadline are skipped and the running reads stop at the deadline, so fewer than num_reads samples may be returned. Defaults to None.
+            target_energy (float, optional): Each read stops as soon as its energy reaches this value. Not checked with replica_packing. Defaults to None.
+            aggregate_samples (bool, optional): If True, the reads are bit-packed and identical ones are merged in C++, so that the response holds the unique samples with num_occurrences. Defaults to False.
+            initial_states (dict, list of dict, or numpy.ndarray, optional): Initial states to warm-start the reads from, given as dicts from the variables to their values or as rows in the order of the sorted variables. The i-th read starts from the (i % len(initial_states))-th state. Defaults to None, which starts from random states.
+            beta_schedule (list, optional): Inverse temperature of each sweep, or pairs of (beta, num_sweeps) to repeat a beta, which overrides beta_min, beta_max, num_sweeps, and temperature_schedule. It need not be monotonic; reverse annealing from initial_states lowers beta and raises it again. Defaults to None.
+            power_law_exponent (float, optional): Exponent p of the "POWER_LAW" schedule, beta_min + (beta_max - beta_min)*(t/(num_sweeps - 1))**p. Defaults to None, which means 2.
+            plateau_ratio (float, optional): Ratio of the sweeps held at beta_max in the "EXPONENTIAL_PLATEAU" schedule. Defaults to None, which means 0.5.
+            graph_coloring (bool, optional): If True, the variables of each color of the interaction graph are updated in parallel by num_threads threads within a read, and the reads are run one by one. This suits very large sparse models with few reads. Only "METROPOLIS" and "HEAT_BATH" are supported, without replica_packing. Defaults to False.
 
         Returns:
             :class:`openjij.sampler.response.Response`: results
@@ -561,7 +646,17 @@ class SASampler(BaseSampler):
                 update_method=updater,
                 random_number_engine=random_number_engine,
                 seed=seed,
-                temperature_schedule=temperature_schedule
+                temperature_schedule=temperature_schedule,
+                replica_packing=replica_packing,
+                fast_acceptance=fast_acceptance,
+                time_limit=time_limit,
+                target_energy=target_energy,
+                aggregate_samples=aggregate_samples,
+                initial_states=initial_states,
+                beta_schedule=beta_schedule,
+                power_law_exponent=power_law_exponent,
+                plateau_ratio=plateau_ratio,
+                graph_coloring=graph_coloring,
             )
     
     def _base_integer_sampler(
@@ -579,6 +674,13 @@ class SASampler(BaseSampler):
         seed: Optional[int] = None,
         temperature_schedule: str = "GEOMETRIC",
         log_history: bool = False,
+        time_limit: Optional[float] = None,
+        target_energy: Optional[float] = None,
+        beta_schedule: Optional[Union[list[float], list[tuple[float, int]], np.ndarray]] = None,
+        power_law_exponent: Optional[float] = None,
+        plateau_ratio: Optional[float] = None,
+        graph_coloring: bool = False,
+        fast_acceptance: bool = False,
     ) -> "oj.sampler.response.Response":
 
         start_solving = time.perf_counter()
@@ -652,12 +754,17 @@ class SASampler(BaseSampler):
         if seed is None:
             seed = np.random.randint(0, 2**32 - 1)
 
+        beta_list = []
+        if beta_schedule is not None:
+            beta_list, num_repeats_list = cast_to_cxx_beta_schedule(beta_schedule)
+            beta_list = np.repeat(beta_list, num_repeats_list).tolist()
+
         preprocess_time = time.perf_counter() - start_solving
 
         # Start sampling
         start_sample = time.perf_counter()
-        cxx_sampler = cxxjij.sampler.sample_by_integer_sa_polynomial if include_higher_order else cxxjij.sampler.sample_by_integer_sa_quadratic
-        cxx_result_list = cxx_sampler(
+        cxx_sampler = cxxjij.sampler.sample_set_by_integer_sa_polynomial if include_higher_order else cxxjij.sampler.sample_set_by_integer_sa_quadratic
+        cxx_sample_set = cxx_sampler(
             model=cxx_model,
             num_sweeps=num_sweeps,
             update_method=cast_to_cxx_update_method(updater),
@@ -669,15 +776,22 @@ class SASampler(BaseSampler):
             min_T=min_T,
             max_T=max_T,
             log_history=log_history,
+            time_limit=math.inf if time_limit is None else time_limit,
+            target_energy=-math.inf if target_energy is None else target_energy,
+            beta_list=beta_list,
+            graph_coloring=graph_coloring,
+            fast_acceptance=fast_acceptance,
+            power_law_exponent=2.0 if power_law_exponent is None else power_law_exponent,
+            plateau_ratio=0.5 if plateau_ratio is None else plateau_ratio,
         )
         sample_time = time.perf_counter() - start_sample
 
         # Make openjij response
         start_make_oj_response = time.perf_counter()
         oj_response = to_oj_response(
-            variables=[r.solution for r in cxx_result_list], 
+            variables=cxx_sample_set.solutions, 
             index_list=self.index_list,
-            energies=[r.energy for r in cxx_result_list],
+            energies=cxx_sample_set.energies,
             vartype=oj.Vartype.DISCRETE
         )
 
@@ -689,13 +803,25 @@ class SASampler(BaseSampler):
             "beta_max": 1.0 / min_T,
             "update_method": updater,
             "random_number_engine": random_number_engine,
-            "temperature_schedule": temperature_schedule,
+            "temperature_schedule": temperature_schedule if beta_schedule is None else "custom schedule",
+            "time_limit": time_limit,
+            "target_energy": target_energy,
             "seed": seed,
+            "graph_coloring": graph_coloring,
+            "fast_acceptance": fast_acceptance,
         }
 
+        # Reads stopped early by time_limit or target_energy have shorter histories
+        if len({len(h) for h in cxx_sample_set.energy_history}) <= 1:
+            energy_history = np.array(cxx_sample_set.energy_history)
+            temperature_history = np.array(cxx_sample_set.temperature_history)
+        else:
+            energy_history = [np.array(h) for h in cxx_sample_set.energy_history]
+            temperature_history = [np.array(h) for h in cxx_sample_set.temperature_history]
+
         oj_response.info["log"] = {
-            "energy_history": np.array([r.energy_history for r in cxx_result_list]),
-            "temperature_history": np.array([r.temperature_history for r in cxx_result_list]),
+            "energy_history": energy_history,
+            "temperature_history": temperature_history,
         }
 
         oj_response.info["time"] = {
@@ -721,6 +847,13 @@ class SASampler(BaseSampler):
         seed: Optional[int] = None,
         temperature_schedule: str = "GEOMETRIC",
         log_history: bool = False,
+        time_limit: Optional[float] = None,
+        target_energy: Optional[float] = None,
+        beta_schedule: Optional[Union[list[float], list[tuple[float, int]], np.ndarray]] = None,
+        power_law_exponent: Optional[float] = None,
+        plateau_ratio: Optional[float] = None,
+        graph_coloring: bool = False,
+        fast_acceptance: bool = False,
     ) -> "oj.sampler.response.Response":
         """Sampling from quadratic unconstrained integer optimization (QUIO).
         This method solves integer optimization problems with interactions up to quadratic order (linear and quadratic terms only).
@@ -734,10 +867,17 @@ class SASampler(BaseSampler):
             beta_min (float, optional): Minimum beta (initial inverse temperature). Defaults to None.
             beta_max (float, optional): Maximum beta (final inverse temperature). Defaults to None.
             updater (str, optional): Updater. One can choose "METROPOLIS", "OPT_METROPOLIS", "HEAT_BATH", and "SUWA_TODO". Defaults to "OPT_METROPOLIS".
-            random_number_engine (str, optional): Random number engine. One can choose "XORSHIFT", "MT", or "MT_64". Defaults to "XORSHIFT".            
+            random_number_engine (str, optional): Random number engine. One can choose "XORSHIFT", "MT", "MT_64", "PHILOX", "XOSHIRO", or "PCG64". Defaults to "XORSHIFT".            
             seed (int, optional): Seed for Monte Carlo algorithm. Defaults to None.
-            temperature_schedule (str, optional): Temperature schedule. One can choose "LINEAR", "GEOMETRIC". Defaults to "GEOMETRIC".
+            temperature_schedule (str, optional): Temperature schedule. One can choose "LINEAR", "GEOMETRIC", "POWER_LAW", or "EXPONENTIAL_PLATEAU". Defaults to "GEOMETRIC".
             log_history (bool, optional): If True, logs the energy and temperature history. Defaults to False.
+            time_limit (float, optional): Wall-clock time limit in seconds. Reads not started by the deadline are skipped and the running reads stop at the deadline, so fewer than num_reads samples may be returned. Defaults to None.
+            target_energy (float, optional): Each read stops as soon as its energy reaches this value. Defaults to None.
+            beta_schedule (list, optional): Inverse temperature of each sweep, or pairs of (beta, num_sweeps) to repeat a beta, which overrides beta_min, beta_max, num_sweeps, and temperature_schedule. Defaults to None.
+            power_law_exponent (float, optional): Exponent p of the "POWER_LAW" schedule, beta_min + (beta_max - beta_min)*(t/(num_sweeps - 1))**p. Defaults to None, which means 2.
+            plateau_ratio (float, optional): Ratio of the sweeps held at beta_max in the "EXPONENTIAL_PLATEAU" schedule. Defaults to None, which means 0.5.
+            graph_coloring (bool, optional): If True, the variables of each color of the interaction graph are updated in parallel by num_threads threads within a read, and the reads are run one by one. Defaults to False.
+            fast_acceptance (bool, optional): If True, the updaters use fast exp, and "METROPOLIS" and "OPT_METROPOLIS" skip hopeless moves. Defaults to False.
 
         Returns:
             :class:`openjij.sampler.response.Response`: results
@@ -764,7 +904,14 @@ class SASampler(BaseSampler):
             random_number_engine=random_number_engine,
             seed=seed,
             temperature_schedule=temperature_schedule,
-            log_history=log_history
+            log_history=log_history,
+            time_limit=time_limit,
+            target_energy=target_energy,
+            beta_schedule=beta_schedule,
+            power_law_exponent=power_law_exponent,
+            plateau_ratio=plateau_ratio,
+            graph_coloring=graph_coloring,
+            fast_acceptance=fast_acceptance,
         )
         
     
@@ -782,6 +929,13 @@ class SASampler(BaseSampler):
         seed: Optional[int] = None,
         temperature_schedule: str = "GEOMETRIC",
         log_history: bool = False,
+        time_limit: Optional[float] = None,
+        target_energy: Optional[float] = None,
+        beta_schedule: Optional[Union[list[float], list[tuple[float, int]], np.ndarray]] = None,
+        power_law_exponent: Optional[float] = None,
+        plateau_ratio: Optional[float] = None,
+        graph_coloring: bool = False,
+        fast_acceptance: bool = False,
     ) -> "oj.sampler.response.Response":
         """Sampling from higher-order unconstrained integer optimization (HUIO).
         This method solves integer optimization problems that can include variable interactions of any order (linear, quadratic, cubic, and higher).
@@ -795,10 +949,17 @@ class SASampler(BaseSampler):
             beta_min (float, optional): Minimum beta (initial inverse temperature). Defaults to None.
             beta_max (float, optional): Maximum beta (final inverse temperature). Defaults to None.
             updater (str, optional): Updater. One can choose "METROPOLIS", "OPT_METROPOLIS", "HEAT_BATH", and "SUWA_TODO". Defaults to "OPT_METROPOLIS".
-            random_number_engine (str, optional): Random number engine. One can choose "XORSHIFT", "MT", or "MT_64". Defaults to "XORSHIFT".            
+            random_number_engine (str, optional): Random number engine. One can choose "XORSHIFT", "MT", "MT_64", "PHILOX", "XOSHIRO", or "PCG64". Defaults to "XORSHIFT".            
             seed (int, optional): Seed for Monte Carlo algorithm. Defaults to None.
-            temperature_schedule (str, optional): Temperature schedule. One can choose "LINEAR", "GEOMETRIC". Defaults to "GEOMETRIC".
+            temperature_schedule (str, optional): Temperature schedule. One can choose "LINEAR", "GEOMETRIC", "POWER_LAW", or "EXPONENTIAL_PLATEAU". Defaults to "GEOMETRIC".
             log_history (bool, optional): If True, logs the energy and temperature history. Defaults to False.
+            time_limit (float, optional): Wall-clock time limit in seconds. Reads not started by the deadline are skipped and the running reads stop at the deadline, so fewer than num_reads samples may be returned. Defaults to None.
+            target_energy (float, optional): Each read stops as soon as its energy reaches this value. Defaults to None.
+            beta_schedule (list, optional): Inverse temperature of each sweep, or pairs of (beta, num_sweeps) to repeat a beta, which overrides beta_min, beta_max, num_sweeps, and temperature_schedule. Defaults to None.
+            power_law_exponent (float, optional): Exponent p of the "POWER_LAW" schedule, beta_min + (beta_max - beta_min)*(t/(num_sweeps - 1))**p. Defaults to None, which means 2.
+            plateau_ratio (float, optional): Ratio of the sweeps held at beta_max in the "EXPONENTIAL_PLATEAU" schedule. Defaults to None, which means 0.5.
+            graph_coloring (bool, optional): If True, the variables of each color of the interaction graph are updated in parallel by num_threads threads within a read, and the reads are run one by one. Defaults to False.
+            fast_acceptance (bool, optional): If True, the updaters use fast exp, and "METROPOLIS" and "OPT_METROPOLIS" skip hopeless moves. Defaults to False.
 
         Returns:
             :class:`openjij.sampler.response.Response`: results
@@ -825,7 +986,14 @@ class SASampler(BaseSampler):
             random_number_engine=random_number_engine,
             seed=seed,
             temperature_schedule=temperature_schedule,
-            log_history=log_history
+            log_history=log_history,
+            time_limit=time_limit,
+            target_energy=target_energy,
+            beta_schedule=beta_schedule,
+            power_law_exponent=power_law_exponent,
+            plateau_ratio=plateau_ratio,
+            graph_coloring=graph_coloring,
+            fast_acceptance=fast_acceptance,
         )
 
 def geometric_hubo_beta_schedule(sa_system, beta_max, beta_min, num_sweeps, seed=None):
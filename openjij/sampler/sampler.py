@@ -158,6 +158,80 @@ class BaseSampler(dimod.Sampler):
 
         return response
 
+    def _cxxjij_batch_sampling(
+        self,
+        model,
+        init_generator,
+        algorithm,
+        system,
+        seed=None,
+        offset=None,
+        num_threads=1,
+        energy_graph=None,
+    ):
+        """Batch sampling function: all reads are executed in cxxjij.
+
+        Each read starts from its own copy of ``system`` reset by ``init_generator``,
+        and the reads are parallelized over ``num_threads`` threads with OpenMP.
+
+        Args:
+            model (openjij.BinaryQuadraticModel): model has a information of instaunce (h, J, Q)
+            init_generator (callable): return initial state, must have argument structure
+            algorithm (callable): batch algorithm of cxxjij (Algorithm_*_run_batch)
+            system (:obj:): template system copied for each read
+            seed (int, optional): seed for algorithm. Defaults to None.
+            offset (float): offset of the Ising energy returned by cxxjij
+            num_threads (int): number of threads. Defaults to 1.
+            energy_graph (:obj:, optional): Ising graph of cxxjij whose ``calc_energy`` gives the energies of the returned states instead of those tracked by ``system``, which drift when ``system`` stores the interactions in low precision. Defaults to None.
+
+        Returns:
+            :class:`openjij.sampler.response.Response`: results
+        """
+
+        if offset is None:
+            offset = 0
+        if seed is None:
+            seed = np.random.randint(np.iinfo(np.int32).max)
+
+        num_reads = self._params["num_reads"]
+        init_states = [init_generator() for _ in range(num_reads)]
+
+        result = {}
+
+        @measure_time
+        def exec_sampling():
+            result["states"], result["energies"] = algorithm(
+                system, init_states, seed, self._params["schedule"], num_threads
+            )
+
+        # Execute sampling function
+        sampling_time = exec_sampling()
+
+        states = np.array(result["states"], dtype=int)
+        if model.vartype == BINARY:
+            states = (states + 1) // 2
+        if energy_graph is not None:
+            result["energies"] = [energy_graph.calc_energy(state) for state in result["states"]]
+        energies = np.array(result["energies"]) + offset
+
+        # construct response instance
+        response = oj.sampler.response.Response.from_samples(
+            (states, list(model.variables)),
+            model.vartype,
+            energies,
+            info={"system": []},
+        )
+
+        # reads run concurrently, so only the average time per read is available
+        execution_time = sampling_time / max(num_reads, 1)
+        response.info["sampling_time"] = sampling_time * 10**6  # micro sec
+        response.info["execution_time"] = execution_time * 10**6  # micro sec
+        response.info["list_exec_times"] = (
+            np.full(num_reads, execution_time) * 10**6
+        )  # micro sec
+
+        return response
+
     def _get_result(self, system, model):
         result = cxxjij.result.get_solution(system)
         sys_info = {}
@@ -82,6 +82,15 @@ class SQASampler(BaseSampler):
         self._algorithm = {
             "singlespinflip": cxxjij.algorithm.Algorithm_SingleSpinFlip_run
         }
+        self._batch_algorithm = {
+            "singlespinflip": cxxjij.algorithm.Algorithm_SingleSpinFlip_run_batch
+        }
+        self._fast_algorithm = {
+            "singlespinflip": cxxjij.algorithm.Algorithm_FastSingleSpinFlip_run
+        }
+        self._fast_batch_algorithm = {
+            "singlespinflip": cxxjij.algorithm.Algorithm_FastSingleSpinFlip_run_batch
+        }
 
     def _convert_validation_schedule(self, schedule, beta):
         if not isinstance(schedule, (list, np.array)):
@@ -151,6 +160,8 @@ class SQASampler(BaseSampler):
         sparse: Optional[bool] = None,
         reinitialize_state: Optional[bool] = None,
         seed: Optional[int] = None,
+        num_threads: int = 1,
+        fast_acceptance: bool = False,
     ) -> "openjij.sampler.response.Response":
         """Sampling from the Ising model.
 
@@ -167,6 +178,8 @@ class SQASampler(BaseSampler):
             sparse (bool): use sparse matrix or not.
             reinitialize_state (bool, optional): Re-initilization at each sampling. Defaults to True.
             seed (int, optional): Sampling seed. Defaults to None.
+            num_threads (int, optional): number of threads. Parallelized for each sampling with num_reads > 1 when reinitialize_state is True. Defaults to 1.
+            fast_acceptance (bool, optional): if true, the acceptance test uses fast exp and skips hopeless moves. Defaults to False.
 
         Raises:
             ValueError:
@@ -273,14 +286,29 @@ class SQASampler(BaseSampler):
         if _updater_name not in self._algorithm:
             raise ValueError('updater is one of "single spin flip"')
         algorithm = self._algorithm[_updater_name]
+        batch_algorithm = self._batch_algorithm[_updater_name]
+        if fast_acceptance:
+            algorithm = self._fast_algorithm[_updater_name]
+            batch_algorithm = self._fast_batch_algorithm[_updater_name]
         sqa_system = self._make_system[_updater_name](
             init_generator(), ising_graph, self._params["gamma"]
         )
         # ------------------------------------------- choose updater
 
-        response = self._cxxjij_sampling(
-            bqm, init_generator, algorithm, sqa_system, reinitialize_state, seed
-        )
+        if reinitialize_state:
+            response = self._cxxjij_batch_sampling(
+                bqm,
+                init_generator,
+                batch_algorithm,
+                sqa_system,
+                seed,
+                offset,
+                num_threads,
+            )
+        else:
+            response = self._cxxjij_sampling(
+                bqm, init_generator, algorithm, sqa_system, reinitialize_state, seed
+            )
 
         response.info["schedule"] = self.schedule_info
 
@@ -1,3 +1,5 @@
+import numpy as np
+
 from openjij.cxxjij.algorithm import (
     UpdateMethod,
     RandomNumberEngine
@@ -14,6 +16,8 @@ def cast_to_cxx_update_method(update_method: str) -> UpdateMethod:
         return UpdateMethod.SUWA_TODO
     elif update_method == "OPT_METROPOLIS":
         return UpdateMethod.OPT_METROPOLIS
+    elif update_method == "REJECTION_FREE":
+        return UpdateMethod.REJECTION_FREE
     else:
         raise RuntimeError(f"Invalid update_method={update_method}")
 
@@ -27,6 +31,12 @@ def cast_to_cxx_random_number_engine(
         return RandomNumberEngine.MT
     elif random_number_engine == "MT_64":
         return RandomNumberEngine.MT_64
+    elif random_number_engine == "PHILOX":
+        return RandomNumberEngine.PHILOX
+    elif random_number_engine == "XOSHIRO":
+        return RandomNumberEngine.XOSHIRO
+    elif random_number_engine == "PCG64":
+        return RandomNumberEngine.PCG64
     else:
         raise RuntimeError(f"Invalid random_number_engine={random_number_engine}")
 
@@ -38,5 +48,26 @@ def cast_to_cxx_temperature_schedule(
         return TemperatureSchedule.GEOMETRIC
     elif temperature_schedule == "LINEAR":
         return TemperatureSchedule.LINEAR
+    elif temperature_schedule == "POWER_LAW":
+        return TemperatureSchedule.POWER_LAW
+    elif temperature_schedule == "EXPONENTIAL_PLATEAU":
+        return TemperatureSchedule.EXPONENTIAL_PLATEAU
     else:
         raise RuntimeError(f"Invalid temperature_schedule={temperature_schedule}")
+
+
+def cast_to_cxx_beta_schedule(beta_schedule) -> tuple[list[float], list[int]]:
+    """Split a beta schedule into the inverse temperatures and the number of sweeps at each of them.
+    Each entry of the schedule is either an inverse temperature for one sweep or a pair of (beta, num_sweeps).
+    """
+    beta_list, num_repeats_list = [], []
+    for entry in beta_schedule:
+        if np.ndim(entry) == 1:
+            if len(entry) != 2:
+                raise ValueError("Each entry of beta_schedule must be beta or (beta, num_sweeps).")
+            beta_list.append(float(entry[0]))
+            num_repeats_list.append(int(entry[1]))
+        else:
+            beta_list.append(float(entry))
+            num_repeats_list.append(1)
+    return beta_list, num_repeats_list
@@ -36,11 +36,15 @@
 #include <openjij/result/all.hpp>
 #include <openjij/utility/schedule_list.hpp>
 #include <openjij/utility/union_find.hpp>
+#include <openjij/utility/graph_coloring.hpp>
+#include <openjij/utility/simd.hpp>
 #include <openjij/utility/random.hpp>
 #include <openjij/utility/min_polynomial.hpp>
 #include <openjij/utility/gpu/memory.hpp>
 #include <openjij/utility/gpu/cublas.hpp>
 #include <openjij/sampler/sa_sampler.hpp>
+#include <openjij/sampler/pt_sampler.hpp>
+#include <openjij/sampler/houdayer_pt_sampler.hpp>
 #include <openjij/sampler/integer_sa_sampler.hpp>
 
 
@@ -55,46 +55,48 @@ TEST(Graph, BinaryPolynomialModelQuad) {
    EXPECT_EQ(bpm.GetIndexMap().at(Tup{2, "a"}), 3);
    EXPECT_EQ(bpm.GetIndexMap().at(Tup{2, "b"}), 4);
    
-   EXPECT_EQ(bpm.GetKeyValueList().size(), 6);
-   EXPECT_EQ(bpm.GetKeyValueList().at(0).first.size(), 1);
-   EXPECT_EQ(bpm.GetKeyValueList().at(1).first.size(), 2);
-   EXPECT_EQ(bpm.GetKeyValueList().at(2).first.size(), 2);
-   EXPECT_EQ(bpm.GetKeyValueList().at(3).first.size(), 1);
-   EXPECT_EQ(bpm.GetKeyValueList().at(4).first.size(), 2);
-   EXPECT_EQ(bpm.GetKeyValueList().at(5).first.size(), 1);
-   
-   EXPECT_DOUBLE_EQ(bpm.GetKeyValueList().at(0).second, +4.0);
-   EXPECT_DOUBLE_EQ(bpm.GetKeyValueList().at(1).second, -1.0);
-   EXPECT_DOUBLE_EQ(bpm.GetKeyValueList().at(2).second, -1.5);
-   EXPECT_DOUBLE_EQ(bpm.GetKeyValueList().at(3).second, +2.0);
-   EXPECT_DOUBLE_EQ(bpm.GetKeyValueList().at(4).second, -2.5);
-   EXPECT_DOUBLE_EQ(bpm.GetKeyValueList().at(5).second, +3.0);
-   
-   EXPECT_EQ(bpm.GetKeyValueList().at(0).first.at(0), 0);
-   EXPECT_EQ(bpm.GetKeyValueList().at(1).first.at(0), 0);
-   EXPECT_EQ(bpm.GetKeyValueList().at(1).first.at(1), 1);
-   EXPECT_EQ(bpm.GetKeyValueList().at(2).first.at(0), 0);
-   EXPECT_EQ(bpm.GetKeyValueList().at(2).first.at(1), 2);
-   EXPECT_EQ(bpm.GetKeyValueList().at(3).first.at(0), 2);
-   EXPECT_EQ(bpm.GetKeyValueList().at(4).first.at(0), 3);
-   EXPECT_EQ(bpm.GetKeyValueList().at(4).first.at(1), 4);
-   EXPECT_EQ(bpm.GetKeyValueList().at(5).first.at(0), 4);
-   
-   EXPECT_EQ(bpm.GetAdjacencyList().size(), 5);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(0).size(), 3);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(0).at(0), 0);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(0).at(1), 1);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(0).at(2), 2);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(1).size(), 1);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(1).at(0), 1);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(2).size(), 2);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(2).at(0), 2);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(2).at(1), 3);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(3).size(), 1);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(3).at(0), 4);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(4).size(), 2);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(4).at(0), 4);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(4).at(1), 5);
+   const auto key_value_list = bpm.BuildKeyValueList();
+   EXPECT_EQ(key_value_list.size(), 6);
+   EXPECT_EQ(key_value_list.at(0).first.size(), 1);
+   EXPECT_EQ(key_value_list.at(1).first.size(), 2);
+   EXPECT_EQ(key_value_list.at(2).first.size(), 2);
+   EXPECT_EQ(key_value_list.at(3).first.size(), 1);
+   EXPECT_EQ(key_value_list.at(4).first.size(), 2);
+   EXPECT_EQ(key_value_list.at(5).first.size(), 1);
+   
+   EXPECT_DOUBLE_EQ(key_value_list.at(0).second, +4.0);
+   EXPECT_DOUBLE_EQ(key_value_list.at(1).second, -1.0);
+   EXPECT_DOUBLE_EQ(key_value_list.at(2).second, -1.5);
+   EXPECT_DOUBLE_EQ(key_value_list.at(3).second, +2.0);
+   EXPECT_DOUBLE_EQ(key_value_list.at(4).second, -2.5);
+   EXPECT_DOUBLE_EQ(key_value_list.at(5).second, +3.0);
+   
+   EXPECT_EQ(key_value_list.at(0).first.at(0), 0);
+   EXPECT_EQ(key_value_list.at(1).first.at(0), 0);
+   EXPECT_EQ(key_value_list.at(1).first.at(1), 1);
+   EXPECT_EQ(key_value_list.at(2).first.at(0), 0);
+   EXPECT_EQ(key_value_list.at(2).first.at(1), 2);
+   EXPECT_EQ(key_value_list.at(3).first.at(0), 2);
+   EXPECT_EQ(key_value_list.at(4).first.at(0), 3);
+   EXPECT_EQ(key_value_list.at(4).first.at(1), 4);
+   EXPECT_EQ(key_value_list.at(5).first.at(0), 4);
+   
+   const auto adjacency_list = bpm.BuildAdjacencyList();
+   EXPECT_EQ(adjacency_list.size(), 5);
+   EXPECT_EQ(adjacency_list.at(0).size(), 3);
+   EXPECT_EQ(adjacency_list.at(0).at(0), 0);
+   EXPECT_EQ(adjacency_list.at(0).at(1), 1);
+   EXPECT_EQ(adjacency_list.at(0).at(2), 2);
+   EXPECT_EQ(adjacency_list.at(1).size(), 1);
+   EXPECT_EQ(adjacency_list.at(1).at(0), 1);
+   EXPECT_EQ(adjacency_list.at(2).size(), 2);
+   EXPECT_EQ(adjacency_list.at(2).at(0), 2);
+   EXPECT_EQ(adjacency_list.at(2).at(1), 3);
+   EXPECT_EQ(adjacency_list.at(3).size(), 1);
+   EXPECT_EQ(adjacency_list.at(3).at(0), 4);
+   EXPECT_EQ(adjacency_list.at(4).size(), 2);
+   EXPECT_EQ(adjacency_list.at(4).at(0), 4);
+   EXPECT_EQ(adjacency_list.at(4).at(1), 5);
 
    EXPECT_DOUBLE_EQ(bpm.GetEstimatedMinEnergyDifference(), 1.0);
    EXPECT_DOUBLE_EQ(bpm.GetEstimatedMaxEnergyDifference(), 6.5);
@@ -129,20 +131,22 @@ TEST(Graph, BinaryPolynomialModelPoly) {
    EXPECT_EQ(bpm.GetIndexMap().at(2)          , 1);
    EXPECT_EQ(bpm.GetIndexMap().at("a")        , 2);
    
-   EXPECT_EQ(bpm.GetKeyValueList().size(), 1);
-   EXPECT_EQ(bpm.GetKeyValueList().at(0).first.size(), 3);
-   EXPECT_DOUBLE_EQ(bpm.GetKeyValueList().at(0).second, 4.0);
-   EXPECT_EQ(bpm.GetKeyValueList().at(0).first.at(0), 0);
-   EXPECT_EQ(bpm.GetKeyValueList().at(0).first.at(1), 1);
-   EXPECT_EQ(bpm.GetKeyValueList().at(0).first.at(2), 2);
-   
-   EXPECT_EQ(bpm.GetAdjacencyList().size(), 3);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(0).size(), 1);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(0).at(0), 0);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(1).size(), 1);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(1).at(0), 0);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(2).size(), 1);
-   EXPECT_EQ(bpm.GetAdjacencyList().at(2).at(0), 0);
+   const auto key_value_list = bpm.BuildKeyValueList();
+   EXPECT_EQ(key_value_list.size(), 1);
+   EXPECT_EQ(key_value_list.at(0).first.size(), 3);
+   EXPECT_DOUBLE_EQ(key_value_list.at(0).second, 4.0);
+   EXPECT_EQ(key_value_list.at(0).first.at(0), 0);
+   EXPECT_EQ(key_value_list.at(0).first.at(1), 1);
+   EXPECT_EQ(key_value_list.at(0).first.at(2), 2);
+   
+   const auto adjacency_list = bpm.BuildAdjacencyList();
+   EXPECT_EQ(adjacency_list.size(), 3);
+   EXPECT_EQ(adjacency_list.at(0).size(), 1);
+   EXPECT_EQ(adjacency_list.at(0).at(0), 0);
+   EXPECT_EQ(adjacency_list.at(1).size(), 1);
+   EXPECT_EQ(adjacency_list.at(1).at(0), 0);
+   EXPECT_EQ(adjacency_list.at(2).size(), 1);
+   EXPECT_EQ(adjacency_list.at(2).at(0), 0);
    
    EXPECT_DOUBLE_EQ(bpm.GetEstimatedMinEnergyDifference(), 4.0);
    EXPECT_DOUBLE_EQ(bpm.GetEstimatedMaxEnergyDifference(), 4.0);
@@ -152,5 +156,45 @@ TEST(Graph, BinaryPolynomialModelPoly) {
 }
 
 
+TEST(Graph, BinaryPolynomialModelCompressedInteractions) {
+   
+   using FloatType = double;
+   using BPM = graph::BinaryPolynomialModel<FloatType>;
+   
+   std::vector<std::vector<typename BPM::IndexType>> key_list = {
+      {0, 1, 2},
+      {3},
+      {1, 3},
+      {2, 3, 4, 0}
+   };
+   
+   std::vector<FloatType> value_list = {
+      +4.0,
+      -1.0,
+      +2.5,
+      -3.0
+   };
+   
+   const auto model = BPM{key_list, value_list};
+   const auto key_value_list = model.BuildKeyValueList();
+   const auto adjacency_list = model.BuildAdjacencyList();
+   
+   ASSERT_EQ(model.GetKeyOffsetList().size(), key_value_list.size() + 1);
+   ASSERT_EQ(model.GetValueList().size(), key_value_list.size());
+   for (std::size_t i = 0; i < key_value_list.size(); ++i) {
+      EXPECT_DOUBLE_EQ(model.GetValueList()[i], key_value_list[i].second);
+      EXPECT_EQ((std::vector<std::int32_t>(model.GetKeyIndexList().begin() + model.GetKeyOffsetList()[i],
+                                           model.GetKeyIndexList().begin() + model.GetKeyOffsetList()[i + 1])),
+                key_value_list[i].first);
+   }
+   
+   ASSERT_EQ(model.GetAdjacencyOffsetList().size(), model.GetSystemSize() + 1);
+   for (std::int32_t i = 0; i < model.GetSystemSize(); ++i) {
+      EXPECT_EQ((std::vector<std::size_t>(model.GetAdjacencyKeyList().begin() + model.GetAdjacencyOffsetList()[i],
+                                          model.GetAdjacencyKeyList().begin() + model.GetAdjacencyOffsetList()[i + 1])),
+                adjacency_list[i]);
+   }
+}
+
 }
 }
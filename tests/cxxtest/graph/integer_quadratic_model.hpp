@@ -21,7 +21,7 @@ TEST(IntegerQuadraticModelTest, BasicFunctionality) {
 
   EXPECT_EQ(model.GetNumVariables(), 3);
 
-  const auto &quadratic = model.GetQuadratic();
+  const auto quadratic = model.BuildQuadratic();
   EXPECT_EQ(quadratic.size(), 3);
   EXPECT_EQ(quadratic[0].size(), 1);
   EXPECT_EQ(quadratic[0][0].first, 1);
@@ -65,5 +65,48 @@ TEST(IntegerQuadraticModelTest, BasicFunctionality) {
   EXPECT_EQ(only_bilinear_index_set.count(0), 0);
 }
 
+TEST(IntegerQuadraticModelTest, CompressedQuadratic) {
+  std::vector<std::vector<std::int64_t>> key_list = {
+      {0, 1}, {1, 2}, {0, 2}, {1, 1}, {2}};
+
+  std::vector<double> value_list = {1.0, -2.0, 3.0, 0.5, 1.5};
+
+  std::vector<std::pair<std::int64_t, std::int64_t>> bounds = {
+      {-1, 1}, {0, 2}, {-2, 3}};
+
+  graph::IntegerQuadraticModel model(key_list, value_list, bounds);
+
+  const auto quadratic = model.BuildQuadratic();
+  const auto &offset_list = model.GetQuadraticOffsetList();
+  const auto &index_list = model.GetQuadraticIndexList();
+  const auto &quad_value_list = model.GetQuadraticValueList();
+
+  EXPECT_EQ(offset_list.size(), 4);
+  EXPECT_EQ(offset_list.back(), 6);
+  for (std::int64_t i = 0; i < model.GetNumVariables(); ++i) {
+    EXPECT_EQ(offset_list[i + 1] - offset_list[i], quadratic[i].size());
+    for (std::size_t k = 0; k < quadratic[i].size(); ++k) {
+      EXPECT_EQ(index_list[offset_list[i] + k], quadratic[i][k].first);
+      EXPECT_DOUBLE_EQ(quad_value_list[offset_list[i] + k],
+                       quadratic[i][k].second);
+    }
+  }
+
+  // Systems reference the model instead of copying it
+  system::IntegerSASystem<graph::IntegerQuadraticModel, utility::Xorshift>
+      sa_system(model, 0);
+  EXPECT_EQ(&sa_system.model, &model);
+
+  // The incrementally updated energy agrees with a full recalculation
+  for (std::int64_t i = 0; i < model.GetNumVariables(); ++i) {
+    sa_system.SetValue(i, bounds[i].second);
+  }
+  EXPECT_DOUBLE_EQ(sa_system.GetEnergy(),
+                   sa_system.CalculateEnergy(sa_system.GetState()));
+  EXPECT_DOUBLE_EQ(sa_system.GetEnergy(), 1.0 * 1 * 2 - 2.0 * 2 * 3 +
+                                              3.0 * 1 * 3 + 0.5 * 2 * 2 +
+                                              1.5 * 3);
+}
+
 } // namespace test
 } // namespace openjij
@@ -40,6 +40,36 @@ TEST(RESULT, GetSolutionFromTrotter){
    EXPECT_EQ(solution, init_trotter_spins[0]);
 }
 
+TEST(RESULT, GetEnergyFromClassicalIsing){
+   auto dense = generate_interaction<openjij::graph::Dense<double>>();
+   auto sparse = generate_interaction<openjij::graph::Sparse<double>>();
+   auto csr_sparse = openjij::graph::CSRSparse<double>(dense.get_interactions().sparseView());
+
+   auto r = openjij::utility::Xorshift(1234);
+   for(int i = 0; i < 10; i++){
+      const auto spins = dense.gen_spin(r);
+      const double energy = dense.calc_energy(spins);
+      EXPECT_NEAR(openjij::result::get_energy(openjij::system::make_classical_ising(spins, dense)), energy, 1e-10);
+      EXPECT_NEAR(openjij::result::get_energy(openjij::system::make_classical_ising(spins, sparse)), energy, 1e-10);
+      EXPECT_NEAR(openjij::result::get_energy(openjij::system::make_classical_ising(spins, csr_sparse)), energy, 1e-10);
+   }
+}
+
+TEST(RESULT, GetEnergyFromTrotter){
+   auto graph = generate_interaction<openjij::graph::Dense<double>>();
+
+   auto r = openjij::utility::Xorshift(1234);
+   int num_trotter_slices = 4;
+   openjij::system::TrotterSpins init_trotter_spins(num_trotter_slices);
+   for(auto& spins : init_trotter_spins){
+      spins = graph.gen_spin(r);
+   }
+
+   auto q_sys = openjij::system::make_transverse_ising(init_trotter_spins, graph, 1.0);
+   // get_energy is the energy of the state returned by get_solution
+   EXPECT_NEAR(openjij::result::get_energy(q_sys), graph.calc_energy(openjij::result::get_solution(q_sys)), 1e-10);
+}
+
 TEST(RESULT, GetSolutionFromChimera){
    auto graph = openjij::graph::Chimera<float>(1,1);
    graph.h(0, 0, 0) = 1.0;
@@ -18,8 +18,11 @@
 #include "ising_polynomial_sa_sampler.hpp"
 #include "integer_quadratic_sa_sampler.hpp"
 #include "integer_polynomial_sa_sampler.hpp"
+#include "polynomial_pt_sampler.hpp"
+#include "houdayer_pt_sampler.hpp"
 #include "quadraitc.hpp"
 #include "polynomial.hpp"
 #include "k_local.hpp"
 #include "swendsen_wang.hpp"
+#include "wolff.hpp"
 #include "gpu.hpp"
@@ -18,6 +18,33 @@
 namespace openjij {
 namespace test {
 
+//! @brief Generate the binary polynomial model of four variables shared by the SASampler tests below, whose minimum energy is -1.5.
+//! @param extra_key_list The keys of the interactions added to the model.
+//! @param extra_value_list The values of the interactions added to the model.
+//! @return The binary polynomial model.
+inline graph::BinaryPolynomialModel<double> GenerateSmallBinaryPolynomialModel(const std::vector<std::vector<utility::IndexType>> &extra_key_list = {},
+                                                                               const std::vector<double> &extra_value_list = {}) {
+   std::vector<std::vector<utility::IndexType>> key_list = {
+      {0, 1, 2},
+      {1, 2},
+      {0},
+      {2, 3},
+      {3}
+   };
+   
+   std::vector<double> value_list = {
+      -2.0,
+      +1.0,
+      -0.5,
+      +1.5,
+      -1.0
+   };
+   
+   key_list.insert(key_list.end(), extra_key_list.begin(), extra_key_list.end());
+   value_list.insert(value_list.end(), extra_value_list.begin(), extra_value_list.end());
+   return graph::BinaryPolynomialModel<double>{key_list, value_list};
+}
+
 TEST(Sampler, SASamplerOperationBinaryPolynomial) {
    
    using FloatType = double;
@@ -51,12 +78,16 @@ TEST(Sampler, SASamplerOperationBinaryPolynomial) {
    std::vector<algorithm::RandomNumberEngine> engine_list = {
       algorithm::RandomNumberEngine::XORSHIFT,
       algorithm::RandomNumberEngine::MT,
-      algorithm::RandomNumberEngine::MT_64
+      algorithm::RandomNumberEngine::MT_64,
+      algorithm::RandomNumberEngine::PHILOX,
+      algorithm::RandomNumberEngine::XOSHIRO,
+      algorithm::RandomNumberEngine::PCG64
    };
    
    std::vector<algorithm::UpdateMethod> updater_list = {
       algorithm::UpdateMethod::METROPOLIS,
-      algorithm::UpdateMethod::HEAT_BATH
+      algorithm::UpdateMethod::HEAT_BATH,
+      algorithm::UpdateMethod::REJECTION_FREE
    };
    
    std::vector<utility::TemperatureSchedule> schedule_list = {
@@ -78,5 +109,255 @@ TEST(Sampler, SASamplerOperationBinaryPolynomial) {
 
 }
 
+TEST(Sampler, SASamplerReplicaPackingBinaryPolynomial) {
+   
+   using FloatType = double;
+   using BPM = graph::BinaryPolynomialModel<FloatType>;
+   
+   std::vector<std::vector<typename BPM::IndexType>> key_list = {
+      {0, 1, 2, 3},
+      {0},
+      {1, 2},
+      {0, 2, 3},
+      {3},
+      {1, 3},
+      {4, 0}
+   };
+   
+   std::vector<FloatType> value_list = {
+      +4.0,
+      +2.0,
+      +3.0,
+      -1.0,
+      -1.5,
+      -2.5,
+      +0.5
+   };
+   
+   const auto model = BPM{key_list, value_list};
+   
+   // Ground state energy by exhaustive search
+   const std::vector<typename BPM::VariableType> values = {0, 1};
+   FloatType min_energy = std::numeric_limits<FloatType>::max();
+   for (std::int32_t bits = 0; bits < (1 << model.GetSystemSize()); ++bits) {
+      std::vector<typename BPM::VariableType> sample(model.GetSystemSize());
+      for (std::int32_t i = 0; i < model.GetSystemSize(); ++i) {
+         sample[i] = values[(bits >> i) & 1];
+      }
+      min_energy = std::min(min_energy, model.CalculateEnergy(sample));
+   }
+   
+   auto sa_sampler = sampler::SASampler{model};
+   sa_sampler.SetBetaMaxAuto();
+   sa_sampler.SetBetaMinAuto();
+   sa_sampler.SetNumReads(100);
+   sa_sampler.SetNumSweeps(100);
+   sa_sampler.SetNumThreads(2);
+   sa_sampler.SetReplicaPacking(true);
+   EXPECT_TRUE(sa_sampler.GetReplicaPacking());
+   
+   for (const auto &algorithm: {algorithm::UpdateMethod::METROPOLIS, algorithm::UpdateMethod::HEAT_BATH}) {
+      sa_sampler.SetUpdateMethod(algorithm);
+      sa_sampler.Sample(1);
+      EXPECT_EQ(sa_sampler.GetSamples().size(), 100);
+      const auto energies = sa_sampler.CalculateEnergies();
+      EXPECT_DOUBLE_EQ(*std::min_element(energies.begin(), energies.end()), min_energy);
+   }
+}
+
+TEST(Sampler, SASamplerSampleBufferBinaryPolynomial) {
+   
+   using BPM = graph::BinaryPolynomialModel<double>;
+   const auto model = GenerateSmallBinaryPolynomialModel();
+   const std::int32_t system_size = model.GetSystemSize();
+   
+   auto sa_sampler = sampler::SASampler{model};
+   sa_sampler.SetBetaMaxAuto();
+   sa_sampler.SetBetaMinAuto();
+   sa_sampler.SetNumSweeps(10);
+   
+   EXPECT_THROW(sa_sampler.GetSampleBuffer(), std::runtime_error);
+   
+   for (const bool replica_packing: {false, true}) {
+      sa_sampler.SetReplicaPacking(replica_packing);
+      sa_sampler.SetNumReads(70);
+      sa_sampler.Sample(1);
+      
+      // The rows of the buffer are the samples
+      const auto buffer = sa_sampler.GetSampleBuffer();
+      const auto samples = sa_sampler.GetSamples();
+      ASSERT_EQ(sa_sampler.GetNumSamples(), 70);
+      ASSERT_EQ(buffer->size(), 70*system_size);
+      for (std::int32_t i = 0; i < 70; ++i) {
+         EXPECT_EQ(std::vector<typename BPM::VariableType>(buffer->begin() + i*system_size, buffer->begin() + (i + 1)*system_size), samples[i]);
+      }
+      
+      // The buffer handed out is kept intact by the next sampling
+      const auto copied = *buffer;
+      sa_sampler.SetNumReads(3);
+      sa_sampler.Sample(2);
+      EXPECT_EQ(*buffer, copied);
+      EXPECT_EQ(sa_sampler.GetSampleBuffer()->size(), 3*system_size);
+   }
+}
+
+TEST(Sampler, SASamplerTrackedEnergiesBinaryPolynomial) {
+   
+   const auto model = GenerateSmallBinaryPolynomialModel();
+   
+   auto sa_sampler = sampler::SASampler{model};
+   sa_sampler.SetBetaMaxAuto();
+   sa_sampler.SetBetaMinAuto();
+   sa_sampler.SetNumSweeps(3);
+   sa_sampler.SetNumReads(70);
+   sa_sampler.SetEnergyCheck(true);
+   EXPECT_TRUE(sa_sampler.GetEnergyCheck());
+   
+   for (const bool replica_packing: {false, true}) {
+      for (const bool aggregate_samples: {false, true}) {
+         sa_sampler.SetReplicaPacking(replica_packing);
+         sa_sampler.SetAggregateSamples(aggregate_samples);
+         EXPECT_NO_THROW(sa_sampler.Sample(1));
+         
+         // The returned energies are those of the samples
+         const auto samples = sa_sampler.GetSamples();
+         const auto energies = sa_sampler.CalculateEnergies();
+         ASSERT_EQ(energies.size(), samples.size());
+         for (std::size_t i = 0; i < samples.size(); ++i) {
+            EXPECT_NEAR(energies[i], model.CalculateEnergy(samples[i]), 1e-10);
+         }
+      }
+   }
+}
+
+TEST(Sampler, SASamplerTemperatureScheduleBinaryPolynomial) {
+   
+   const auto model = GenerateSmallBinaryPolynomialModel();
+   
+   auto sa_sampler = sampler::SASampler{model};
+   sa_sampler.SetBetaMaxAuto();
+   sa_sampler.SetBetaMinAuto();
+   sa_sampler.SetNumSweeps(100);
+   sa_sampler.SetNumReads(10);
+   
+   EXPECT_THROW(sa_sampler.SetPowerLawExponent(0.0), std::runtime_error);
+   EXPECT_THROW(sa_sampler.SetPlateauRatio(1.0), std::runtime_error);
+   sa_sampler.SetPowerLawExponent(3.0);
+   sa_sampler.SetPlateauRatio(0.2);
+   EXPECT_DOUBLE_EQ(sa_sampler.GetPowerLawExponent(), 3.0);
+   EXPECT_DOUBLE_EQ(sa_sampler.GetPlateauRatio(), 0.2);
+   
+   for (const auto schedule: {utility::TemperatureSchedule::POWER_LAW, utility::TemperatureSchedule::EXPONENTIAL_PLATEAU}) {
+      sa_sampler.SetTemperatureSchedule(schedule);
+      sa_sampler.Sample(1);
+      for (const auto energy: sa_sampler.CalculateEnergies()) {
+         EXPECT_DOUBLE_EQ(energy, -1.5);
+      }
+   }
+   
+   // Each beta is repeated
+   sa_sampler.SetBetaList({0.1, 1.0, 10.0}, {5, 5, 20});
+   EXPECT_EQ(sa_sampler.GetBetaList().size(), 30);
+   EXPECT_DOUBLE_EQ(sa_sampler.GetBetaList()[5], 1.0);
+   sa_sampler.Sample(1);
+   for (const auto energy: sa_sampler.CalculateEnergies()) {
+      EXPECT_DOUBLE_EQ(energy, -1.5);
+   }
+   EXPECT_THROW(sa_sampler.SetBetaList({0.1, 1.0}, {5}), std::runtime_error);
+}
+
+TEST(Sampler, SASamplerAggregateSamplesBinaryPolynomial) {
+   
+   const auto model = GenerateSmallBinaryPolynomialModel();
+   
+   auto sa_sampler = sampler::SASampler{model};
+   sa_sampler.SetBetaMaxAuto();
+   sa_sampler.SetBetaMinAuto();
+   sa_sampler.SetNumSweeps(20);
+   sa_sampler.SetNumReads(200);
+   sa_sampler.SetNumThreads(2);
+   sa_sampler.SetAggregateSamples(true);
+   EXPECT_TRUE(sa_sampler.GetAggregateSamples());
+   
+   for (const bool replica_packing: {false, true}) {
+      sa_sampler.SetReplicaPacking(replica_packing);
+      sa_sampler.Sample(1);
+      
+      // At most 2^4 unique samples, whose occurrences add up to the number of reads
+      const auto samples = sa_sampler.GetSamples();
+      const auto num_occurrences = sa_sampler.GetNumOccurrences();
+      const auto energies = sa_sampler.CalculateEnergies();
+      ASSERT_EQ(samples.size(), sa_sampler.GetNumSamples());
+      EXPECT_LE(samples.size(), 16);
+      ASSERT_EQ(num_occurrences.size(), samples.size());
+      ASSERT_EQ(energies.size(), samples.size());
+      EXPECT_EQ(std::accumulate(num_occurrences.begin(), num_occurrences.end(), 0), 200);
+      auto sorted_samples = samples;
+      std::sort(sorted_samples.begin(), sorted_samples.end());
+      EXPECT_EQ(std::adjacent_find(sorted_samples.begin(), sorted_samples.end()), sorted_samples.end());
+      for (std::size_t i = 0; i < samples.size(); ++i) {
+         EXPECT_DOUBLE_EQ(energies[i], model.CalculateEnergy(samples[i]));
+      }
+      EXPECT_EQ(sa_sampler.GetSampleStore()->num_samples(), 200);
+   }
+   
+   sa_sampler.SetAggregateSamples(false);
+   sa_sampler.Sample(1);
+   EXPECT_EQ(sa_sampler.GetNumOccurrences(), std::vector<std::int32_t>(200, 1));
+   EXPECT_THROW(sa_sampler.GetSampleStore(), std::runtime_error);
+}
+
+TEST(Sampler, SASamplerPhiloxThreadIndependentBinaryPolynomial) {
+   
+   const auto model = GenerateSmallBinaryPolynomialModel();
+   
+   auto sa_sampler = sampler::SASampler{model};
+   sa_sampler.SetNumSweeps(5);
+   sa_sampler.SetNumReads(100);
+   sa_sampler.SetRandomNumberEngine(algorithm::RandomNumberEngine::PHILOX);
+   
+   // The samples of each read do not depend on the number of threads
+   for (const bool replica_packing: {false, true}) {
+      sa_sampler.SetReplicaPacking(replica_packing);
+      sa_sampler.SetNumThreads(1);
+      sa_sampler.Sample(3);
+      const auto samples = sa_sampler.GetSamples();
+      sa_sampler.SetNumThreads(4);
+      sa_sampler.Sample(3);
+      EXPECT_EQ(sa_sampler.GetSamples(), samples);
+   }
+}
+
+TEST(Sampler, SASamplerGraphColoringBinaryPolynomial) {
+   
+   // Two separate parts, so that the variables of a color are updated at the same time
+   const auto model = GenerateSmallBinaryPolynomialModel({{4, 5}, {5}}, {-1.0, +0.5});
+   
+   auto sa_sampler = sampler::SASampler{model};
+   sa_sampler.SetNumSweeps(100);
+   sa_sampler.SetNumReads(10);
+   sa_sampler.SetGraphColoring(true);
+   EXPECT_TRUE(sa_sampler.GetGraphColoring());
+   
+   // The samples of each read do not depend on the number of threads
+   for (const auto update_method: {algorithm::UpdateMethod::METROPOLIS, algorithm::UpdateMethod::HEAT_BATH}) {
+      sa_sampler.SetUpdateMethod(update_method);
+      sa_sampler.SetNumThreads(1);
+      sa_sampler.Sample(3);
+      const auto samples = sa_sampler.GetSamples();
+      sa_sampler.SetNumThreads(4);
+      sa_sampler.Sample(3);
+      EXPECT_EQ(sa_sampler.GetSamples(), samples);
+      const auto energies = sa_sampler.CalculateEnergies();
+      EXPECT_DOUBLE_EQ(*std::min_element(energies.begin(), energies.end()), -2.0);
+   }
+   
+   sa_sampler.SetUpdateMethod(algorithm::UpdateMethod::SUWA_TODO);
+   EXPECT_THROW(sa_sampler.Sample(3), std::runtime_error);
+   sa_sampler.SetUpdateMethod(algorithm::UpdateMethod::METROPOLIS);
+   sa_sampler.SetReplicaPacking(true);
+   EXPECT_THROW(sa_sampler.Sample(3), std::runtime_error);
+}
+
 }
 }
@@ -0,0 +1,114 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+
+namespace openjij {
+namespace test {
+
+TEST(Houdayer, ClusterMoveKeepsTotalEnergy) {
+    using namespace openjij;
+
+    const auto interaction = generate_interaction<graph::Dense<double>>();
+    Eigen::SparseMatrix<double, Eigen::RowMajor> sp_mat = interaction.get_interactions().sparseView();
+    const auto interaction_csr = graph::CSRSparse<double>(sp_mat.template triangularView<Eigen::Upper>());
+    auto engine_for_spin = std::mt19937(1);
+    auto system_a = system::make_classical_ising(interaction.gen_spin(engine_for_spin), interaction_csr);
+    auto system_b = system::make_classical_ising(interaction.gen_spin(engine_for_spin), interaction_csr);
+    using SystemType = decltype(system_a);
+
+    auto random_number_engine = std::mt19937(1);
+    for (std::size_t i = 0; i < 20; ++i) {
+        const double total_energy = system_a.energy + system_b.energy;
+        const auto spin_a = result::get_solution(system_a);
+        const auto spin_b = result::get_solution(system_b);
+        const auto cluster_size = updater::Houdayer<SystemType>::update(system_a, system_b, random_number_engine);
+
+        //only the disagreeing spins are flipped in both replicas
+        std::size_t num_flipped = 0;
+        for (std::size_t j = 0; j < spin_a.size(); ++j) {
+            const bool is_flipped = spin_a[j] != result::get_solution(system_a)[j];
+            EXPECT_EQ(is_flipped, spin_b[j] != result::get_solution(system_b)[j]);
+            if (is_flipped) {
+                EXPECT_NE(spin_a[j], spin_b[j]);
+                ++num_flipped;
+            }
+        }
+        EXPECT_EQ(num_flipped, cluster_size);
+        EXPECT_NEAR(system_a.energy + system_b.energy, total_energy, 1e-10);
+        EXPECT_NEAR(system_a.energy, interaction.calc_energy(result::get_solution(system_a)), 1e-10);
+        EXPECT_NEAR(system_b.energy, interaction.calc_energy(result::get_solution(system_b)), 1e-10);
+
+        //decorrelate the replicas for the next move
+        algorithm::Algorithm<updater::SingleSpinFlip>::run(system_a, random_number_engine, utility::make_classical_schedule_list(0.1, 1.0, 1, 1));
+    }
+
+    //identical replicas have no cluster
+    auto system_c = system_a;
+    EXPECT_EQ(updater::Houdayer<SystemType>::update(system_a, system_c, random_number_engine), 0);
+}
+
+TEST(Sampler, HoudayerPTSamplerFindTrueGroundState) {
+    using namespace openjij;
+
+    const auto interaction = generate_interaction<graph::Sparse<double>>();
+    auto pt_sampler = sampler::make_houdayer_pt_sampler(interaction);
+    pt_sampler.SetNumSweeps(200);
+    pt_sampler.SetNumReads(2);
+    pt_sampler.SetNumTemperatures(8);
+    pt_sampler.SetBetaMin(0.1);
+    pt_sampler.SetBetaMax(10.0);
+    pt_sampler.Sample(1);
+
+    for (const auto &sample : pt_sampler.GetSamples()) {
+        EXPECT_EQ(get_true_groundstate(), sample);
+    }
+    for (const auto energy : pt_sampler.CalculateEnergies()) {
+        EXPECT_NEAR(energy, interaction.calc_energy(get_true_groundstate()), 1e-10);
+    }
+    EXPECT_EQ(pt_sampler.GetBetaList().size(), 8);
+    EXPECT_EQ(pt_sampler.GetExchangeAcceptanceRates().size(), 7);
+    EXPECT_EQ(pt_sampler.GetMeanClusterSizes().size(), 8);
+}
+
+TEST(Sampler, HoudayerPTSamplerChimera) {
+    using namespace openjij;
+
+    const auto interaction = generate_chimera_interaction<double>();
+    auto pt_sampler = sampler::make_houdayer_pt_sampler(interaction);
+    pt_sampler.SetNumSweeps(500);
+    pt_sampler.SetNumTemperatures(8);
+    pt_sampler.SetBetaMin(0.1);
+    pt_sampler.SetBetaMax(10.0);
+    pt_sampler.SetNumThreads(2);
+    pt_sampler.Sample(1);
+
+    EXPECT_EQ(get_true_chimera_groundstate(interaction), pt_sampler.GetSamples()[0]);
+
+    //without the cluster moves, no cluster is flipped
+    pt_sampler.SetHoudayerBetaMin(100.0);
+    pt_sampler.Sample(1);
+    for (const auto cluster_size : pt_sampler.GetMeanClusterSizes()) {
+        EXPECT_EQ(cluster_size, 0);
+    }
+
+    EXPECT_THROW(pt_sampler.SetNumTemperatures(1), std::runtime_error);
+    EXPECT_THROW(pt_sampler.SetHoudayerBetaMin(-1.0), std::runtime_error);
+    pt_sampler.SetBetaMin(20.0);
+    EXPECT_THROW(pt_sampler.Sample(1), std::runtime_error);
+}
+
+}
+}
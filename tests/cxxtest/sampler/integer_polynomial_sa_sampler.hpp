@@ -30,7 +30,10 @@ TEST(Sampler, IntegerSASamplerPolynomial) {
 
   std::vector<algorithm::RandomNumberEngine> engine_list = {
       algorithm::RandomNumberEngine::XORSHIFT,
-      algorithm::RandomNumberEngine::MT, algorithm::RandomNumberEngine::MT_64};
+      algorithm::RandomNumberEngine::MT, algorithm::RandomNumberEngine::MT_64,
+      algorithm::RandomNumberEngine::PHILOX,
+      algorithm::RandomNumberEngine::XOSHIRO,
+      algorithm::RandomNumberEngine::PCG64};
 
   std::vector<algorithm::UpdateMethod> updater_list = {
       algorithm::UpdateMethod::METROPOLIS, algorithm::UpdateMethod::HEAT_BATH};
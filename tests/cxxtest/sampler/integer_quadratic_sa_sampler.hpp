@@ -28,7 +28,10 @@ TEST(Sampler, IntegerSASamplerQuadratic) {
 
   std::vector<algorithm::RandomNumberEngine> engine_list = {
       algorithm::RandomNumberEngine::XORSHIFT,
-      algorithm::RandomNumberEngine::MT, algorithm::RandomNumberEngine::MT_64};
+      algorithm::RandomNumberEngine::MT, algorithm::RandomNumberEngine::MT_64,
+      algorithm::RandomNumberEngine::PHILOX,
+      algorithm::RandomNumberEngine::XOSHIRO,
+      algorithm::RandomNumberEngine::PCG64};
 
   std::vector<algorithm::UpdateMethod> updater_list = {
       algorithm::UpdateMethod::METROPOLIS, algorithm::UpdateMethod::HEAT_BATH};
@@ -48,5 +51,258 @@ TEST(Sampler, IntegerSASamplerQuadratic) {
   }
 }
 
+TEST(Sampler, IntegerSASamplerQuadraticStoppingCriteria) {
+
+  // Minimized at x_i = 2 for all i with the energy -2 * num_variables
+  const std::int64_t num_variables = 100;
+  std::vector<std::vector<std::int64_t>> key_list;
+  std::vector<double> value_list;
+  std::vector<std::pair<std::int64_t, std::int64_t>> bounds;
+  for (std::int64_t i = 0; i < num_variables; ++i) {
+    key_list.push_back({i});
+    value_list.push_back(-1.0);
+    bounds.emplace_back(-2, 2);
+  }
+
+  graph::IntegerQuadraticModel model(key_list, value_list, bounds);
+  const std::int64_t num_sweeps = 1000000;
+
+  EXPECT_THROW(sampler::SampleByIntegerSA(
+                   model, num_sweeps, algorithm::UpdateMethod::METROPOLIS,
+                   algorithm::RandomNumberEngine::XORSHIFT,
+                   utility::TemperatureSchedule::GEOMETRIC, 8, 0, 1, 0.1, 5.0,
+                   false, 0.0),
+               std::runtime_error);
+
+  // Only the first read is carried out, and it stops at the deadline
+  const auto time_limited = sampler::SampleByIntegerSA(
+      model, num_sweeps, algorithm::UpdateMethod::METROPOLIS,
+      algorithm::RandomNumberEngine::XORSHIFT,
+      utility::TemperatureSchedule::GEOMETRIC, 8, 0, 1, 0.1, 5.0, true, 0.05);
+  ASSERT_EQ(time_limited.size(), 1);
+  EXPECT_LT(time_limited[0].energy_history.size(), num_sweeps);
+
+  // Each read stops once the target energy is reached
+  const auto targeted = sampler::SampleByIntegerSA(
+      model, num_sweeps, algorithm::UpdateMethod::METROPOLIS,
+      algorithm::RandomNumberEngine::XORSHIFT,
+      utility::TemperatureSchedule::GEOMETRIC, 4, 0, 2, 0.1, 5.0, true,
+      std::numeric_limits<double>::infinity(), -50.0);
+  ASSERT_EQ(targeted.size(), 4);
+  for (const auto &result : targeted) {
+    EXPECT_LE(result.energy, -50.0);
+    EXPECT_LT(result.energy_history.size(), num_sweeps);
+  }
+}
+
+TEST(Sampler, IntegerSASamplerQuadraticSampleSet) {
+
+  std::vector<std::vector<std::int64_t>> key_list = {
+      {0, 0}, {1, 0}, {2}, {1, 2}, {}};
+
+  std::vector<double> value_list = {1.0, -1.0, 3.0, 0.5, 0.5};
+
+  std::vector<std::pair<std::int64_t, std::int64_t>> bounds = {
+      {-2, 1}, {0, 3}, {-1, 2}};
+
+  graph::IntegerQuadraticModel model(key_list, value_list, bounds);
+
+  const auto results = sampler::SampleByIntegerSA(
+      model, 50, algorithm::UpdateMethod::METROPOLIS,
+      algorithm::RandomNumberEngine::XORSHIFT,
+      utility::TemperatureSchedule::GEOMETRIC, 5, 3, 2, 0.1, 5.0, true);
+  const auto sample_set = sampler::SampleSetByIntegerSA(
+      model, 50, algorithm::UpdateMethod::METROPOLIS,
+      algorithm::RandomNumberEngine::XORSHIFT,
+      utility::TemperatureSchedule::GEOMETRIC, 5, 3, 2, 0.1, 5.0, true);
+
+  // The rows of the buffer are the solutions with the same seeds
+  const std::int64_t num_variables = model.GetNumVariables();
+  EXPECT_EQ(sample_set.num_variables, num_variables);
+  ASSERT_EQ(sample_set.solution_buffer->size(), 5 * num_variables);
+  ASSERT_EQ(sample_set.energies.size(), 5);
+  for (std::int64_t i = 0; i < 5; ++i) {
+    EXPECT_EQ(std::vector<std::int64_t>(
+                  sample_set.solution_buffer->begin() + i * num_variables,
+                  sample_set.solution_buffer->begin() + (i + 1) * num_variables),
+              results[i].solution);
+    EXPECT_DOUBLE_EQ(sample_set.energies[i], results[i].energy);
+    EXPECT_EQ(sample_set.energy_history[i], results[i].energy_history);
+  }
+}
+
+TEST(Sampler, IntegerSASamplerQuadraticBetaList) {
+
+  std::vector<std::vector<std::int64_t>> key_list = {
+      {0, 0}, {1, 0}, {2}, {1, 2}, {}};
+
+  std::vector<double> value_list = {1.0, -1.0, 3.0, 0.5, 0.5};
+
+  std::vector<std::pair<std::int64_t, std::int64_t>> bounds = {
+      {-2, 1}, {0, 3}, {-1, 2}};
+
+  graph::IntegerQuadraticModel model(key_list, value_list, bounds);
+
+  // The beta list overrides the number of sweeps and the schedule
+  const std::vector<double> beta_list =
+      utility::RepeatBetaList<double>({0.0, 0.5, 4.0}, {1, 2, 3});
+  const auto results = sampler::SampleByIntegerSA(
+      model, 50, algorithm::UpdateMethod::METROPOLIS,
+      algorithm::RandomNumberEngine::XORSHIFT,
+      utility::TemperatureSchedule::GEOMETRIC, 3, 3, 1, 0.1, 5.0, true,
+      std::numeric_limits<double>::infinity(),
+      -std::numeric_limits<double>::infinity(), beta_list);
+  ASSERT_EQ(results.size(), 3);
+  const std::vector<double> temperature_list = {
+      std::numeric_limits<double>::infinity(), 2.0, 2.0, 0.25, 0.25, 0.25};
+  for (const auto &result : results) {
+    EXPECT_EQ(result.temperature_history, temperature_list);
+  }
+
+  // The same read is reproduced by SolveByIntegerSA with the beta list
+  const auto result = sampler::SolveByIntegerSA(
+      model, beta_list, algorithm::UpdateMethod::METROPOLIS,
+      algorithm::RandomNumberEngine::XORSHIFT,
+      static_cast<std::int64_t>(utility::DeriveSeed(3, 0)), true);
+  EXPECT_EQ(result.solution, results[0].solution);
+  EXPECT_EQ(result.energy_history, results[0].energy_history);
+
+  // The built-in schedules decrease the temperature from max_T to min_T
+  for (const auto schedule : {utility::TemperatureSchedule::POWER_LAW,
+                              utility::TemperatureSchedule::EXPONENTIAL_PLATEAU}) {
+    const auto result = sampler::SolveByIntegerSA(
+        model, 20, algorithm::UpdateMethod::HEAT_BATH,
+        algorithm::RandomNumberEngine::MT, schedule, 0, 0.1, 5.0, true);
+    ASSERT_EQ(result.temperature_history.size(), 20);
+    EXPECT_NEAR(result.temperature_history.front(), 5.0, 1e-10);
+    EXPECT_NEAR(result.temperature_history.back(), 0.1, 1e-10);
+  }
+
+  // The parameters of the schedules are passed to utility::GenerateBetaList
+  const auto power_law_result = sampler::SolveByIntegerSA(
+      model, 20, algorithm::UpdateMethod::HEAT_BATH,
+      algorithm::RandomNumberEngine::MT,
+      utility::TemperatureSchedule::POWER_LAW, 0, 0.1, 5.0, true,
+      sampler::Deadline::max(), -std::numeric_limits<double>::infinity(),
+      nullptr, false, 1.0);
+  const auto power_law_beta_list = utility::GenerateBetaList(
+      utility::TemperatureSchedule::POWER_LAW, 0.2, 10.0, 20, 1.0);
+  for (std::size_t sweep = 0; sweep < power_law_beta_list.size(); ++sweep) {
+    EXPECT_NEAR(power_law_result.temperature_history[sweep],
+                1.0 / power_law_beta_list[sweep], 1e-10);
+  }
+  const auto plateau_result = sampler::SampleByIntegerSA(
+      model, 20, algorithm::UpdateMethod::HEAT_BATH,
+      algorithm::RandomNumberEngine::MT,
+      utility::TemperatureSchedule::EXPONENTIAL_PLATEAU, 1, 0, 1, 0.1, 5.0,
+      true, std::numeric_limits<double>::infinity(),
+      -std::numeric_limits<double>::infinity(), {}, false, false, 2.0, 0.75);
+  ASSERT_EQ(plateau_result.size(), 1);
+  EXPECT_NEAR(plateau_result[0].temperature_history[4], 0.1, 1e-10);
+  EXPECT_GT(plateau_result[0].temperature_history[3], 0.1 + 1e-10);
+  EXPECT_THROW(sampler::GenerateTemperatureList(
+                   utility::TemperatureSchedule::POWER_LAW, 20, 0.1, 5.0, 0.0),
+               std::runtime_error);
+  EXPECT_THROW(sampler::GenerateTemperatureList(
+                   utility::TemperatureSchedule::EXPONENTIAL_PLATEAU, 20, 0.1,
+                   5.0, 2.0, 1.0),
+               std::runtime_error);
+
+  EXPECT_THROW(sampler::SolveByIntegerSA(
+                   model, std::vector<double>{1.0, -1.0},
+                   algorithm::UpdateMethod::METROPOLIS,
+                   algorithm::RandomNumberEngine::XORSHIFT, 0, false),
+               std::runtime_error);
+}
+
+TEST(Sampler, IntegerSASamplerQuadraticGraphColoring) {
+
+  std::vector<std::vector<std::int64_t>> key_list = {
+      {0, 0}, {1, 0}, {2}, {1, 2}, {3, 4}, {4}, {}};
+
+  std::vector<double> value_list = {1.0, -1.0, 3.0, 0.5, -2.0, 1.0, 0.5};
+
+  std::vector<std::pair<std::int64_t, std::int64_t>> bounds = {
+      {-2, 1}, {0, 3}, {-1, 2}, {0, 2}, {-1, 1}};
+
+  graph::IntegerQuadraticModel model(key_list, value_list, bounds);
+
+  // Interacting variables have different colors
+  const auto color_list = sampler::GenerateColorList(model);
+  std::vector<std::int64_t> color(model.GetNumVariables(), -1);
+  for (std::size_t c = 0; c < color_list.size(); ++c) {
+    for (const auto i : color_list[c]) {
+      color[i] = static_cast<std::int64_t>(c);
+    }
+  }
+  EXPECT_NE(color[0], color[1]);
+  EXPECT_NE(color[1], color[2]);
+  EXPECT_NE(color[3], color[4]);
+
+  // The samples of each read do not depend on the number of threads
+  for (const auto update_method :
+       {algorithm::UpdateMethod::METROPOLIS,
+        algorithm::UpdateMethod::OPT_METROPOLIS,
+        algorithm::UpdateMethod::HEAT_BATH,
+        algorithm::UpdateMethod::SUWA_TODO}) {
+    const auto sample_set = sampler::SampleSetByIntegerSA(
+        model, 100, update_method, algorithm::RandomNumberEngine::XORSHIFT,
+        utility::TemperatureSchedule::GEOMETRIC, 5, 3, 1, 0.1, 5.0, false,
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(), {}, true);
+    const auto parallel_sample_set = sampler::SampleSetByIntegerSA(
+        model, 100, update_method, algorithm::RandomNumberEngine::XORSHIFT,
+        utility::TemperatureSchedule::GEOMETRIC, 5, 3, 4, 0.1, 5.0, false,
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(), {}, true);
+    EXPECT_EQ(*sample_set.solution_buffer,
+              *parallel_sample_set.solution_buffer);
+    EXPECT_EQ(sample_set.energies, parallel_sample_set.energies);
+    EXPECT_DOUBLE_EQ(
+        *std::min_element(sample_set.energies.begin(), sample_set.energies.end()),
+        -9.0);
+  }
+}
+
+TEST(Sampler, IntegerSASamplerQuadraticFastAcceptance) {
+
+  std::vector<std::vector<std::int64_t>> key_list = {
+      {0, 0}, {1, 0}, {2}, {1, 2}, {3, 4}, {4}, {}};
+
+  std::vector<double> value_list = {1.0, -1.0, 3.0, 0.5, -2.0, 1.0, 0.5};
+
+  std::vector<std::pair<std::int64_t, std::int64_t>> bounds = {
+      {-2, 1}, {0, 3}, {-1, 2}, {0, 2}, {-1, 1}};
+
+  graph::IntegerQuadraticModel model(key_list, value_list, bounds);
+
+  // The fast acceptance test finds the ground state with every updater
+  for (const auto update_method :
+       {algorithm::UpdateMethod::METROPOLIS,
+        algorithm::UpdateMethod::OPT_METROPOLIS,
+        algorithm::UpdateMethod::HEAT_BATH,
+        algorithm::UpdateMethod::SUWA_TODO}) {
+    const auto sample_set = sampler::SampleSetByIntegerSA(
+        model, 100, update_method, algorithm::RandomNumberEngine::XORSHIFT,
+        utility::TemperatureSchedule::GEOMETRIC, 5, 3, 1, 0.1, 5.0, false,
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(), {}, false, true);
+    EXPECT_DOUBLE_EQ(
+        *std::min_element(sample_set.energies.begin(), sample_set.energies.end()),
+        -9.0);
+  }
+
+  // Hopeless moves are rejected, so that the energy never increases at a
+  // huge beta
+  const auto result = sampler::SolveByIntegerSA(
+      model, std::vector<double>(10, 1e+6), algorithm::UpdateMethod::METROPOLIS,
+      algorithm::RandomNumberEngine::XORSHIFT, 3, true,
+      sampler::Deadline::max(), -std::numeric_limits<double>::infinity(),
+      nullptr, true);
+  for (std::size_t i = 1; i < result.energy_history.size(); ++i) {
+    EXPECT_LE(result.energy_history[i], result.energy_history[i - 1]);
+  }
+}
+
 } // namespace test
 } // namespace openjij
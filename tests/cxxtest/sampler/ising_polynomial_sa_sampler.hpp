@@ -51,12 +51,16 @@ TEST(Sampler, SASamplerOperationIsingPolynomial) {
    std::vector<algorithm::RandomNumberEngine> engine_list = {
       algorithm::RandomNumberEngine::XORSHIFT,
       algorithm::RandomNumberEngine::MT,
-      algorithm::RandomNumberEngine::MT_64
+      algorithm::RandomNumberEngine::MT_64,
+      algorithm::RandomNumberEngine::PHILOX,
+      algorithm::RandomNumberEngine::XOSHIRO,
+      algorithm::RandomNumberEngine::PCG64
    };
    
    std::vector<algorithm::UpdateMethod> updater_list = {
       algorithm::UpdateMethod::METROPOLIS,
-      algorithm::UpdateMethod::HEAT_BATH
+      algorithm::UpdateMethod::HEAT_BATH,
+      algorithm::UpdateMethod::REJECTION_FREE
    };
    
    std::vector<utility::TemperatureSchedule> schedule_list = {
@@ -78,6 +82,175 @@ TEST(Sampler, SASamplerOperationIsingPolynomial) {
 
 }
 
+TEST(Sampler, SASamplerReplicaPackingIsingPolynomial) {
+   
+   using FloatType = double;
+   using IPM = graph::IsingPolynomialModel<FloatType>;
+   
+   std::vector<std::vector<typename IPM::IndexType>> key_list = {
+      {0, 1, 2, 3},
+      {0},
+      {1, 2},
+      {0, 2, 3},
+      {3},
+      {1, 3},
+      {4, 0}
+   };
+   
+   std::vector<FloatType> value_list = {
+      +4.0,
+      +2.0,
+      +3.0,
+      -1.0,
+      -1.5,
+      -2.5,
+      +0.5
+   };
+   
+   const auto model = IPM{key_list, value_list};
+   
+   // Ground state energy by exhaustive search
+   const std::vector<typename IPM::VariableType> values = {-1, +1};
+   FloatType min_energy = std::numeric_limits<FloatType>::max();
+   for (std::int32_t bits = 0; bits < (1 << model.GetSystemSize()); ++bits) {
+      std::vector<typename IPM::VariableType> sample(model.GetSystemSize());
+      for (std::int32_t i = 0; i < model.GetSystemSize(); ++i) {
+         sample[i] = values[(bits >> i) & 1];
+      }
+      min_energy = std::min(min_energy, model.CalculateEnergy(sample));
+   }
+   
+   auto sa_sampler = sampler::SASampler{model};
+   sa_sampler.SetBetaMaxAuto();
+   sa_sampler.SetBetaMinAuto();
+   sa_sampler.SetNumReads(100);
+   sa_sampler.SetNumSweeps(100);
+   sa_sampler.SetNumThreads(2);
+   sa_sampler.SetReplicaPacking(true);
+   EXPECT_TRUE(sa_sampler.GetReplicaPacking());
+   
+   for (const auto &algorithm: {algorithm::UpdateMethod::METROPOLIS, algorithm::UpdateMethod::HEAT_BATH}) {
+      sa_sampler.SetUpdateMethod(algorithm);
+      sa_sampler.Sample(1);
+      EXPECT_EQ(sa_sampler.GetSamples().size(), 100);
+      const auto energies = sa_sampler.CalculateEnergies();
+      EXPECT_DOUBLE_EQ(*std::min_element(energies.begin(), energies.end()), min_energy);
+   }
+}
+
+TEST(Sampler, SASamplerWarmStartIsingPolynomial) {
+   
+   using FloatType = double;
+   using IPM = graph::IsingPolynomialModel<FloatType>;
+   
+   // Ferromagnetic chain whose ground state is all +1 with the energy -4
+   std::vector<std::vector<typename IPM::IndexType>> key_list = {
+      {0, 1},
+      {1, 2},
+      {2, 3},
+      {0}
+   };
+   std::vector<FloatType> value_list = {-1.0, -1.0, -1.0, -1.0};
+   const auto ipm = IPM{key_list, value_list};
+   const std::vector<typename IPM::VariableType> ground_state = {+1, +1, +1, +1};
+   const std::vector<typename IPM::VariableType> flipped_state = {-1, -1, -1, -1};
+   
+   auto sa_sampler = sampler::SASampler{ipm};
+   sa_sampler.SetNumReads(70);
+   sa_sampler.SetEnergyCheck(true);
+   
+   EXPECT_THROW(sa_sampler.SetInitialStates({{+1, +1, +1}}), std::runtime_error);
+   EXPECT_THROW(sa_sampler.SetInitialStates({{+1, +1, 0, +1}}), std::runtime_error);
+   EXPECT_THROW(sa_sampler.SetBetaList({1.0, -1.0}), std::runtime_error);
+   
+   sa_sampler.SetInitialStates({ground_state});
+   EXPECT_EQ(sa_sampler.GetInitialStates().size(), 1);
+   
+   for (const bool replica_packing: {false, true}) {
+      sa_sampler.SetReplicaPacking(replica_packing);
+      
+      // The reads stay at the initial state while it is cold
+      sa_sampler.SetBetaList({100.0, 100.0});
+      sa_sampler.Sample(1);
+      for (const auto &sample: sa_sampler.GetSamples()) {
+         EXPECT_EQ(sample, ground_state);
+      }
+      
+      // At beta = 0 every variable of the initial state is flipped in a Metropolis sweep
+      sa_sampler.SetBetaList({0.0});
+      sa_sampler.Sample(1);
+      for (const auto &sample: sa_sampler.GetSamples()) {
+         EXPECT_EQ(sample, flipped_state);
+      }
+      
+      // Reverse annealing from a local state: reheat, then re-cool
+      sa_sampler.SetInitialStates({flipped_state, ground_state});
+      std::vector<FloatType> beta_list = {10.0, 1.0, 0.1};
+      for (std::int32_t i = 0; i < 50; ++i) {
+         beta_list.push_back(10.0);
+      }
+      sa_sampler.SetBetaList(beta_list);
+      EXPECT_EQ(sa_sampler.GetBetaList(), beta_list);
+      sa_sampler.Sample(1);
+      ASSERT_EQ(sa_sampler.GetNumSamples(), 70);
+      for (const auto energy: sa_sampler.CalculateEnergies()) {
+         EXPECT_DOUBLE_EQ(energy, -4.0);
+      }
+      sa_sampler.SetInitialStates({ground_state});
+   }
+   
+   // Empty lists restore the random initial states and the generated schedule
+   sa_sampler.SetInitialStates({});
+   sa_sampler.SetBetaList({});
+   sa_sampler.SetReplicaPacking(false);
+   EXPECT_NO_THROW(sa_sampler.Sample(1));
+}
+
+TEST(Sampler, SASamplerStoppingCriteriaIsingPolynomial) {
+   
+   using FloatType = double;
+   using IPM = graph::IsingPolynomialModel<FloatType>;
+   
+   // Ferromagnetic chain, whose ground state energy is -(system_size - 1)
+   const std::int32_t system_size = 200;
+   std::vector<std::vector<typename IPM::IndexType>> key_list;
+   std::vector<FloatType> value_list;
+   for (std::int32_t i = 0; i < system_size - 1; ++i) {
+      key_list.push_back({i, i + 1});
+      value_list.push_back(-1.0);
+   }
+   
+   const auto model = IPM{key_list, value_list};
+   
+   auto sa_sampler = sampler::SASampler{model};
+   sa_sampler.SetBetaMin(0.1);
+   sa_sampler.SetBetaMax(10.0);
+   sa_sampler.SetNumSweeps(1000000);
+   sa_sampler.SetNumReads(8);
+   sa_sampler.SetNumThreads(1);
+   EXPECT_THROW(sa_sampler.SetTimeLimit(0), std::runtime_error);
+   
+   // Only the first read is carried out, and it stops at the deadline
+   sa_sampler.SetTimeLimit(0.05);
+   EXPECT_DOUBLE_EQ(sa_sampler.GetTimeLimit(), 0.05);
+   sa_sampler.Sample(1);
+   EXPECT_EQ(sa_sampler.GetSamples().size(), 1);
+   EXPECT_EQ(sa_sampler.CalculateEnergies().size(), 1);
+   
+   // Each read stops within a sweep after reaching the target, far above the ground state
+   sa_sampler.SetTimeLimit(std::numeric_limits<double>::infinity());
+   sa_sampler.SetTargetEnergy(0.0);
+   EXPECT_DOUBLE_EQ(sa_sampler.GetTargetEnergy(), 0.0);
+   for (const auto &algorithm: {algorithm::UpdateMethod::METROPOLIS, algorithm::UpdateMethod::HEAT_BATH, algorithm::UpdateMethod::REJECTION_FREE}) {
+      sa_sampler.SetUpdateMethod(algorithm);
+      sa_sampler.Sample(1);
+      EXPECT_EQ(sa_sampler.GetSamples().size(), 8);
+      for (const auto &energy: sa_sampler.CalculateEnergies()) {
+         EXPECT_LE(energy, 0.0);
+         EXPECT_GT(energy, -(system_size - 1)/2.0);
+      }
+   }
+}
 
 }
 }
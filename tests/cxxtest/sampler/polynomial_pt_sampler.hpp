@@ -0,0 +1,186 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+
+namespace openjij {
+namespace test {
+
+TEST(Sampler, PTSamplerIsingPolynomial) {
+   
+   using FloatType = double;
+   using IPM = graph::IsingPolynomialModel<FloatType>;
+   
+   std::vector<std::vector<typename IPM::IndexType>> key_list = {
+      {0, 1, 2, 3},
+      {0},
+      {1, 2},
+      {0, 2, 3},
+      {3},
+      {1, 3},
+      {4, 0}
+   };
+   
+   std::vector<FloatType> value_list = {
+      +4.0,
+      +2.0,
+      +3.0,
+      -1.0,
+      -1.5,
+      -2.5,
+      +0.5
+   };
+   
+   const auto model = IPM{key_list, value_list};
+   
+   // Ground state energy by exhaustive search
+   const std::vector<typename IPM::VariableType> values = {-1, +1};
+   FloatType min_energy = std::numeric_limits<FloatType>::max();
+   for (std::int32_t bits = 0; bits < (1 << model.GetSystemSize()); ++bits) {
+      std::vector<typename IPM::VariableType> sample(model.GetSystemSize());
+      for (std::int32_t i = 0; i < model.GetSystemSize(); ++i) {
+         sample[i] = values[(bits >> i) & 1];
+      }
+      min_energy = std::min(min_energy, model.CalculateEnergy(sample));
+   }
+   
+   auto pt_sampler = sampler::PTSampler{model};
+   pt_sampler.SetBetaMaxAuto();
+   pt_sampler.SetBetaMinAuto();
+   pt_sampler.SetNumReads(3);
+   pt_sampler.SetNumSweeps(200);
+   pt_sampler.SetNumReplicas(8);
+   pt_sampler.SetNumThreads(2);
+   
+   for (const auto &algorithm: {algorithm::UpdateMethod::METROPOLIS, algorithm::UpdateMethod::HEAT_BATH}) {
+      pt_sampler.SetUpdateMethod(algorithm);
+      pt_sampler.Sample(1);
+      EXPECT_EQ(pt_sampler.GetSamples().size(), 3);
+      for (const auto &energy: pt_sampler.CalculateEnergies()) {
+         EXPECT_DOUBLE_EQ(energy, min_energy);
+      }
+   }
+   
+   EXPECT_THROW(pt_sampler.SetNumReplicas(1), std::runtime_error);
+   EXPECT_THROW(pt_sampler.SetExchangeInterval(0), std::runtime_error);
+}
+
+TEST(Sampler, PTSamplerBinaryPolynomial) {
+   
+   using FloatType = double;
+   using BPM = graph::BinaryPolynomialModel<FloatType>;
+   
+   std::vector<std::vector<typename BPM::IndexType>> key_list = {
+      {0, 1, 2, 3},
+      {0},
+      {1, 2},
+      {0, 2, 3},
+      {3},
+      {1, 3},
+      {4, 0}
+   };
+   
+   std::vector<FloatType> value_list = {
+      +4.0,
+      +2.0,
+      +3.0,
+      -1.0,
+      -1.5,
+      -2.5,
+      +0.5
+   };
+   
+   const auto model = BPM{key_list, value_list};
+   
+   // Ground state energy by exhaustive search
+   FloatType min_energy = std::numeric_limits<FloatType>::max();
+   for (std::int32_t bits = 0; bits < (1 << model.GetSystemSize()); ++bits) {
+      std::vector<typename BPM::VariableType> sample(model.GetSystemSize());
+      for (std::int32_t i = 0; i < model.GetSystemSize(); ++i) {
+         sample[i] = (bits >> i) & 1;
+      }
+      min_energy = std::min(min_energy, model.CalculateEnergy(sample));
+   }
+   
+   auto pt_sampler = sampler::PTSampler{model};
+   pt_sampler.SetBetaMaxAuto();
+   pt_sampler.SetBetaMinAuto();
+   pt_sampler.SetNumReads(3);
+   pt_sampler.SetNumSweeps(200);
+   pt_sampler.SetNumReplicas(8);
+   pt_sampler.SetExchangeInterval(2);
+   
+   pt_sampler.Sample(1);
+   EXPECT_EQ(pt_sampler.GetSamples().size(), 3);
+   for (const auto &energy: pt_sampler.CalculateEnergies()) {
+      EXPECT_DOUBLE_EQ(energy, min_energy);
+   }
+   
+   // The state of the rejection-free update is not kept over the exchanges
+   EXPECT_THROW(pt_sampler.SetUpdateMethod(algorithm::UpdateMethod::REJECTION_FREE), std::runtime_error);
+}
+
+TEST(Sampler, PTSamplerAdaptiveLadder) {
+   
+   using FloatType = double;
+   using IPM = graph::IsingPolynomialModel<FloatType>;
+   
+   // Random cubic interactions
+   std::mt19937 random_number_engine(1);
+   std::uniform_int_distribution<std::int32_t> dist_index(0, 29);
+   std::uniform_real_distribution<FloatType> dist_value(-1, 1);
+   std::vector<std::vector<typename IPM::IndexType>> key_list;
+   std::vector<FloatType> value_list;
+   for (std::int32_t i = 0; i < 100; ++i) {
+      key_list.push_back({dist_index(random_number_engine), dist_index(random_number_engine), dist_index(random_number_engine)});
+      value_list.push_back(dist_value(random_number_engine));
+   }
+   const auto model = IPM{key_list, value_list};
+   
+   auto pt_sampler = sampler::PTSampler{model};
+   pt_sampler.SetBetaMin(0.1);
+   pt_sampler.SetBetaMax(10.0);
+   pt_sampler.SetNumReplicas(8);
+   pt_sampler.SetNumSweeps(4000);
+   
+   double fixed_min_rate = 0;
+   for (const auto adaptive_ladder: {false, true}) {
+      pt_sampler.SetAdaptiveLadder(adaptive_ladder);
+      pt_sampler.Sample(1);
+      
+      const auto &beta_list = pt_sampler.GetBetaList();
+      ASSERT_EQ(beta_list.size(), 8);
+      EXPECT_DOUBLE_EQ(beta_list.front(), 0.1);
+      EXPECT_NEAR(beta_list.back(), 10.0, 1e-10);
+      EXPECT_TRUE(std::is_sorted(beta_list.begin(), beta_list.end()));
+      
+      const auto &rates = pt_sampler.GetExchangeAcceptanceRates();
+      ASSERT_EQ(rates.size(), 7);
+      for (const auto &rate: rates) {
+         EXPECT_GE(rate, 0.0);
+         EXPECT_LE(rate, 1.0);
+      }
+      // The adapted ladder improves the worst exchange acceptance rate
+      if (adaptive_ladder) {
+         EXPECT_GT(*std::min_element(rates.begin(), rates.end()), fixed_min_rate);
+      }
+      else {
+         fixed_min_rate = *std::min_element(rates.begin(), rates.end());
+      }
+   }
+}
+
+}
+}
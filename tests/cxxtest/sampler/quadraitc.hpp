@@ -149,6 +149,176 @@ TEST(SingleSpinFlip, FindTrueGroundState_TransverseIsing_CSRSparse) {
     EXPECT_EQ(get_true_groundstate(), result::get_solution(transverse_ising));
 }
 
+TEST(FastSingleSpinFlip, FindTrueGroundState_ClassicalIsing_Sparse) {
+    using namespace openjij;
+
+    //generate classical sparse system
+    const auto interaction = generate_interaction<graph::Sparse<double>>();
+    auto engine_for_spin = std::mt19937(1);
+    const auto spin = interaction.gen_spin(engine_for_spin);
+    auto classical_ising = system::make_classical_ising(spin, interaction);
+    
+    auto random_numder_engine = std::mt19937(1);
+    const auto schedule_list = generate_schedule_list();
+
+    algorithm::Algorithm<updater::FastSingleSpinFlip>::run(classical_ising, random_numder_engine, schedule_list);
+
+    EXPECT_EQ(get_true_groundstate(), result::get_solution(classical_ising));
+}
+
+TEST(FastSingleSpinFlip, FindTrueGroundState_TransverseIsing_Dense) {
+    using namespace openjij;
+
+    //generate classical dense system
+    const auto interaction = generate_interaction<graph::Dense<double>>();
+    auto engine_for_spin = std::mt19937(1);
+    std::size_t num_trotter_slices = 10;
+
+    //generate random trotter spins
+    system::TrotterSpins init_trotter_spins(num_trotter_slices);
+    for(auto& spins : init_trotter_spins){
+        spins = interaction.gen_spin(engine_for_spin);
+    }
+
+    auto transverse_ising = system::make_transverse_ising(init_trotter_spins, interaction, 1.0);
+    
+    auto random_numder_engine = std::mt19937(1);
+    const auto schedule_list = generate_tfm_schedule_list();
+
+    algorithm::Algorithm<updater::FastSingleSpinFlip>::run(transverse_ising, random_numder_engine, schedule_list);
+
+    EXPECT_EQ(get_true_groundstate(), result::get_solution(transverse_ising));
+}
+
+TEST(ColoredSingleSpinFlip, FindTrueGroundState_ClassicalIsing_Sparse) {
+    using namespace openjij;
+
+    //generate classical sparse system
+    const auto interaction = generate_interaction<graph::Sparse<double>>();
+    auto engine_for_spin = std::mt19937(1);
+    const auto spin = interaction.gen_spin(engine_for_spin);
+    auto classical_ising = system::make_classical_ising(spin, interaction);
+    
+    auto random_numder_engine = std::mt19937(1);
+    const auto schedule_list = generate_schedule_list();
+
+    using Updater = updater::ColoredSingleSpinFlip<decltype(classical_ising)>;
+    Updater::run(classical_ising, random_numder_engine, schedule_list, Updater::generate_color_list(classical_ising), 0);
+
+    EXPECT_EQ(get_true_groundstate(), result::get_solution(classical_ising));
+}
+
+TEST(ColoredSingleSpinFlip, FindTrueGroundState_ClassicalIsing_CSRSparse) {
+    using namespace openjij;
+
+    //generate classical dense system
+    const auto dense_interaction = generate_interaction<graph::Dense<double>>();
+    //output sparse interaction
+    Eigen::SparseMatrix<double, Eigen::RowMajor> sp_mat = dense_interaction.get_interactions().sparseView();
+    const auto interaction = graph::CSRSparse<double>(sp_mat.template triangularView<Eigen::Upper>());
+    auto engine_for_spin = std::mt19937(1);
+    const auto spin = interaction.gen_spin(engine_for_spin);
+    auto classical_ising = system::make_classical_ising(spin, interaction);
+    
+    auto random_numder_engine = std::mt19937(1);
+    const auto schedule_list = generate_schedule_list();
+
+    using Updater = updater::ColoredSingleSpinFlip<decltype(classical_ising)>;
+    Updater::run(classical_ising, random_numder_engine, schedule_list, Updater::generate_color_list(classical_ising), 0);
+
+    EXPECT_EQ(get_true_groundstate(), result::get_solution(classical_ising));
+}
+
+TEST(ColoredSingleSpinFlip, ThreadCountIndependent_ClassicalIsing_Sparse) {
+    using namespace openjij;
+
+    //generate a 16x16 periodic lattice with the couplings of +-1, whose two colors hold 128 spins each
+    const std::size_t length = 16;
+    auto interaction = graph::Sparse<double>(length*length);
+    auto engine_for_interaction = std::mt19937(1);
+    for (std::size_t x = 0; x < length; ++x) {
+        for (std::size_t y = 0; y < length; ++y) {
+            const std::size_t i = x*length + y;
+            interaction.J(i, ((x + 1) % length)*length + y) = engine_for_interaction() % 2 ? 1.0 : -1.0;
+            interaction.J(i, x*length + (y + 1) % length) = engine_for_interaction() % 2 ? 1.0 : -1.0;
+            interaction.h(i) = engine_for_interaction() % 2 ? 1.0 : -1.0;
+        }
+    }
+    auto engine_for_spin = std::mt19937(1);
+    const auto spin = interaction.gen_spin(engine_for_spin);
+    const auto schedule_list = utility::make_classical_schedule_list(0.1, 5.0, 10, 10);
+
+    // The additions to dE are exact for integer couplings, so that the threads do not change the result.
+    // The coloring is made once and shared by the runs.
+    using Updater = updater::ColoredSingleSpinFlip<system::ClassicalIsing<graph::Sparse<double>>>;
+    const auto color_list = Updater::generate_color_list(system::make_classical_ising(spin, interaction));
+    std::vector<graph::Spins> solution_list;
+    for (const int num_threads: {1, 4}) {
+        auto classical_ising = system::make_classical_ising(spin, interaction);
+        auto random_numder_engine = std::mt19937(1);
+        Updater::run(classical_ising, random_numder_engine, schedule_list, color_list, num_threads);
+        solution_list.push_back(result::get_solution(classical_ising));
+        EXPECT_DOUBLE_EQ(classical_ising.energy, interaction.calc_energy(solution_list.back()));
+    }
+    EXPECT_EQ(solution_list[0], solution_list[1]);
+}
+
+TEST(SingleSpinFlip, FindTrueGroundState_CompactClassicalIsing_Dense) {
+    using namespace openjij;
+
+    //generate classical dense system with float32 and bfloat16 storage
+    const auto interaction = generate_interaction<graph::Dense<double>>();
+    auto engine_for_spin = std::mt19937(1);
+    const auto spin = interaction.gen_spin(engine_for_spin);
+    auto compact_ising = system::make_compact_classical_ising(spin, interaction);
+    auto bf16_ising = system::make_compact_classical_ising<utility::BFloat16>(spin, interaction);
+    
+    auto random_numder_engine = std::mt19937(1);
+    const auto schedule_list = generate_schedule_list();
+
+    // The best of several reads, since a single read ends in the flipped local minimum in a few percent of the seeds
+    const auto best_solution = [&](auto &system, const auto &run) {
+        graph::Spins best;
+        for (std::size_t read = 0; read < 4; ++read) {
+            system.reset_spins(interaction.gen_spin(engine_for_spin));
+            run(system);
+            const auto solution = result::get_solution(system);
+            if (best.empty() || interaction.calc_energy(solution) < interaction.calc_energy(best)) {
+                best = solution;
+            }
+        }
+        return best;
+    };
+
+    EXPECT_EQ(get_true_groundstate(), best_solution(compact_ising, [&](auto &system) {
+        algorithm::Algorithm<updater::SingleSpinFlip>::run(system, random_numder_engine, schedule_list);
+    }));
+    EXPECT_EQ(get_true_groundstate(), best_solution(bf16_ising, [&](auto &system) {
+        algorithm::Algorithm<updater::FastSingleSpinFlip>::run(system, random_numder_engine, schedule_list);
+    }));
+}
+
+TEST(SingleSpinFlip, FindTrueGroundState_ReplicaPackedClassicalIsing_Dense) {
+    using namespace openjij;
+
+    //generate classical dense system with four replicas
+    const auto interaction = generate_interaction<graph::Dense<double>>();
+    auto engine_for_spin = std::mt19937(1);
+    std::vector<graph::Spins> init_spins;
+    for (std::size_t r = 0; r < 4; ++r) {
+        init_spins.push_back(interaction.gen_spin(engine_for_spin));
+    }
+    auto packed_ising = system::make_replica_packed_classical_ising(init_spins, interaction);
+
+    auto random_numder_engine = std::mt19937(1);
+    const auto schedule_list = generate_schedule_list();
+
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(packed_ising, random_numder_engine, schedule_list);
+
+    for (const auto &solution : result::get_solution(packed_ising)) {
+        EXPECT_EQ(get_true_groundstate(), solution);
+    }
+}
 
 }
 }
@@ -0,0 +1,97 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+
+namespace openjij {
+namespace test {
+
+TEST(Wolff, FindTrueGroundState_ClassicalIsing_Sparse_OneDimensionalIsing) {
+    using namespace openjij;
+
+    const auto interaction = [](){
+        auto interaction = graph::Sparse<double>(num_system_size);
+        interaction.J(0,1) = -1;
+        interaction.J(1,2) = -1;
+        interaction.J(2,3) = -1;
+        interaction.J(3,4) = -1;
+        interaction.J(4,5) = +1;
+        interaction.J(5,6) = +1;
+        interaction.J(6,7) = +1;
+        interaction.h(0) = +1;
+        return interaction;
+    }();
+    auto engine_for_spin = std::mt19937(1);
+    const auto spin = interaction.gen_spin(engine_for_spin);
+    auto classical_ising = system::make_classical_ising(spin, interaction);
+
+    auto random_number_engine = std::mt19937(1);
+    const auto schedule_list = generate_schedule_list();
+
+    algorithm::Algorithm<updater::Wolff>::run(classical_ising, random_number_engine, schedule_list);
+
+    EXPECT_EQ(openjij::graph::Spins({-1, -1, -1, -1, -1, +1, -1, +1}), result::get_solution(classical_ising));
+}
+
+TEST(Wolff, FindTrueGroundState_ClassicalIsing_Sparse) {
+    using namespace openjij;
+
+    const auto interaction = generate_interaction<graph::Sparse<double>>();
+    auto engine_for_spin = std::mt19937(1);
+    const auto spin = interaction.gen_spin(engine_for_spin);
+
+    //cluster updates are not efficient in simulating frustrated systems, and one read finds the ground state only at a fraction of the seeds.
+    //take the best of the reads of different seeds.
+    const auto schedule_list = openjij::utility::make_classical_schedule_list(0.1, 100.0, 10, 100);
+    graph::Spins best_solution;
+    double best_energy = std::numeric_limits<double>::max();
+    for (std::uint32_t seed = 0; seed < 32; ++seed) {
+        auto classical_ising = system::make_classical_ising(spin, interaction);
+        auto random_numder_engine = std::mt19937(seed);
+        algorithm::Algorithm<updater::Wolff>::run(classical_ising, random_numder_engine, schedule_list);
+        const auto energy = interaction.calc_energy(result::get_solution(classical_ising));
+        if (energy < best_energy) {
+            best_energy = energy;
+            best_solution = result::get_solution(classical_ising);
+        }
+    }
+
+    EXPECT_EQ(get_true_groundstate(), best_solution);
+}
+
+TEST(Wolff, TrackEnergy_ClassicalIsing_CSRSparse) {
+    using namespace openjij;
+
+    const auto interaction = generate_interaction<graph::Dense<double>>();
+    Eigen::SparseMatrix<double, Eigen::RowMajor> sp_mat = interaction.get_interactions().sparseView();
+    const auto interaction_csr = graph::CSRSparse<double>(sp_mat.template triangularView<Eigen::Upper>());
+    auto engine_for_spin = std::mt19937(1);
+    const auto spin = interaction.gen_spin(engine_for_spin);
+    auto classical_ising = system::make_classical_ising(spin, interaction_csr);
+
+    auto random_numder_engine = std::mt19937(1);
+    const auto schedule_list = utility::make_classical_schedule_list(0.1, 10.0, 5, 5);
+
+    //the flips of the clusters keep the energy and dE up to date
+    algorithm::Algorithm<updater::Wolff>::run(classical_ising, random_numder_engine, schedule_list);
+    EXPECT_NEAR(classical_ising.energy, interaction.calc_energy(result::get_solution(classical_ising)), 1e-10);
+    const auto dE = classical_ising.dE;
+    classical_ising.reset_dE();
+    EXPECT_TRUE(dE.isApprox(classical_ising.dE, 1e-10));
+    EXPECT_EQ(classical_ising.spin(classical_ising.num_spins), 1);
+}
+
+}
+}
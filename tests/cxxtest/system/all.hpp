@@ -19,3 +19,4 @@
 #include "k_local.hpp"
 #include "binary_polynomial_sa_system.hpp"
 #include "ising_polynomial_sa_system.hpp"
+#include "replica_packed_sa_system.hpp"
@@ -208,5 +208,38 @@ TEST(System, BinaryPolynomialSystemExplicitPoly) {
    EXPECT_DOUBLE_EQ(sa_system.GetEnergyDifference(2), -4.0);
 }
 
+TEST(System, BinaryPolynomialSystemEnergy) {
+   using BPM = graph::BinaryPolynomialModel<double>;
+   
+   std::vector<std::vector<typename BPM::IndexType>> key_list = {
+      {0, 1, 2},
+      {0},
+      {1, 3},
+      {2, 3, 4},
+      {},
+      {4, 0}
+   };
+   
+   std::vector<double> value_list = {
+      +4.0,
+      +2.0,
+      -3.0,
+      -1.5,
+      +0.5,
+      -2.5
+   };
+   
+   const auto model = BPM{key_list, value_list};
+   auto sa_system = system::SASystem<BPM, std::mt19937>{model, 1};
+   EXPECT_DOUBLE_EQ(sa_system.GetEnergy(), model.CalculateEnergy(sa_system.ExtractSample()));
+   
+   std::mt19937 random_number_engine(2);
+   std::uniform_int_distribution<std::int32_t> dist(0, sa_system.GetSystemSize() - 1);
+   for (std::int32_t i = 0; i < 100; ++i) {
+      sa_system.Flip(dist(random_number_engine));
+      EXPECT_DOUBLE_EQ(sa_system.GetEnergy(), model.CalculateEnergy(sa_system.ExtractSample()));
+   }
+}
+
 }
 }
@@ -35,5 +35,153 @@ TEST(ClassicalIsing, GenerateTheSameEigenObject){
     EXPECT_EQ(m1, m2);
 }
 
+TEST(ClassicalIsing, TrackEnergy){
+    using namespace openjij;
+    const auto dense = generate_interaction<graph::Dense<double>>();
+    const auto sparse = generate_interaction<graph::Sparse<double>>();
+    const auto csr_sparse = graph::CSRSparse<double>(dense.get_interactions().sparseView());
+    const auto schedule_list = utility::make_classical_schedule_list(0.1, 10.0, 5, 5);
+
+    auto engine_for_spin = std::mt19937(1);
+    const auto spin = dense.gen_spin(engine_for_spin);
+
+    auto cl_dense = system::make_classical_ising(spin, dense);
+    auto cl_sparse = system::make_classical_ising(spin, sparse);
+    auto cl_csr_sparse = system::make_classical_ising(spin, csr_sparse);
+    EXPECT_NEAR(cl_dense.energy, dense.calc_energy(spin), 1e-10);
+
+    auto random_number_engine = std::mt19937(1);
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_dense, random_number_engine, schedule_list);
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_sparse, random_number_engine, schedule_list);
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_csr_sparse, random_number_engine, schedule_list);
+    EXPECT_NEAR(cl_dense.energy, dense.calc_energy(result::get_solution(cl_dense)), 1e-10);
+    EXPECT_NEAR(cl_sparse.energy, dense.calc_energy(result::get_solution(cl_sparse)), 1e-10);
+    EXPECT_NEAR(cl_csr_sparse.energy, dense.calc_energy(result::get_solution(cl_csr_sparse)), 1e-10);
+
+    // The cluster updates keep the energy and dE consistent for the following single spin flips
+    algorithm::Algorithm<updater::SwendsenWang>::run(cl_sparse, random_number_engine, schedule_list);
+    EXPECT_NEAR(cl_sparse.energy, dense.calc_energy(result::get_solution(cl_sparse)), 1e-10);
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_sparse, random_number_engine, schedule_list);
+    EXPECT_NEAR(cl_sparse.energy, dense.calc_energy(result::get_solution(cl_sparse)), 1e-10);
+
+    cl_dense.reset_spins(spin);
+    EXPECT_NEAR(cl_dense.energy, dense.calc_energy(spin), 1e-10);
+}
+
+TEST(ClassicalIsing, SparseKernelMatchesDense){
+    using namespace openjij;
+    const auto dense = generate_interaction<graph::Dense<double>>();
+    const auto sparse = generate_interaction<graph::Sparse<double>>();
+    const auto csr_sparse = graph::CSRSparse<double>(dense.get_interactions().sparseView());
+    const auto schedule_list = utility::make_classical_schedule_list(0.1, 10.0, 5, 5);
+
+    auto engine_for_spin = std::mt19937(1);
+    const auto spin = dense.gen_spin(engine_for_spin);
+
+    auto cl_dense = system::make_classical_ising(spin, dense);
+    auto cl_sparse = system::make_classical_ising(spin, sparse);
+    auto cl_csr_sparse = system::make_classical_ising(spin, csr_sparse);
+
+    // The CSR kernel of the sparse graphs flips the same spins as the dense one
+    // for the same random numbers
+    auto engine_dense = std::mt19937(2);
+    auto engine_sparse = std::mt19937(2);
+    auto engine_csr_sparse = std::mt19937(2);
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_dense, engine_dense, schedule_list);
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_sparse, engine_sparse, schedule_list);
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_csr_sparse, engine_csr_sparse, schedule_list);
+    EXPECT_EQ(result::get_solution(cl_dense), result::get_solution(cl_sparse));
+    EXPECT_EQ(result::get_solution(cl_dense), result::get_solution(cl_csr_sparse));
+    for (std::size_t i = 0; i < cl_dense.num_spins; ++i) {
+        EXPECT_NEAR(cl_dense.dE(i), cl_sparse.dE(i), 1e-10);
+        EXPECT_NEAR(cl_dense.dE(i), cl_csr_sparse.dE(i), 1e-10);
+    }
+    EXPECT_NEAR(cl_dense.energy, cl_sparse.energy, 1e-10);
+    EXPECT_NEAR(cl_dense.energy, cl_csr_sparse.energy, 1e-10);
+
+    // The spins written from outside are picked up at the next update
+    cl_sparse.spin = cl_dense.spin;
+    cl_sparse.spin *= -1;
+    cl_sparse.spin(cl_sparse.num_spins) = 1;
+    cl_sparse.reset_dE();
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_sparse, engine_sparse, schedule_list);
+    EXPECT_NEAR(cl_sparse.energy, dense.calc_energy(result::get_solution(cl_sparse)), 1e-10);
+}
+
+TEST(ClassicalIsing, CompactStorageTracksEnergy){
+    using namespace openjij;
+    const auto dense = generate_interaction<graph::Dense<double>>();
+    const auto schedule_list = utility::make_classical_schedule_list(0.1, 10.0, 5, 5);
+
+    auto engine_for_spin = std::mt19937(1);
+    const auto spin = dense.gen_spin(engine_for_spin);
+
+    auto cl_dense = system::make_classical_ising(spin, dense);
+    auto cl_compact = system::make_compact_classical_ising(spin, dense);
+    EXPECT_NEAR(cl_compact.energy, cl_dense.energy, 1e-5);
+    for (std::size_t i = 0; i < cl_dense.num_spins; ++i) {
+        EXPECT_NEAR(cl_compact.dE[i], cl_dense.dE(i), 1e-5);
+    }
+
+    // float32 couplings and dE follow the double ones for the same random numbers
+    auto engine_dense = std::mt19937(2);
+    auto engine_compact = std::mt19937(2);
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_dense, engine_dense, schedule_list);
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_compact, engine_compact, schedule_list);
+    EXPECT_EQ(result::get_solution(cl_dense), result::get_solution(cl_compact));
+    EXPECT_NEAR(result::get_energy(cl_compact), dense.calc_energy(result::get_solution(cl_compact)), 1e-5);
+
+    cl_compact.reset_spins(spin);
+    EXPECT_NEAR(cl_compact.energy, dense.calc_energy(spin), 1e-5);
+    EXPECT_EQ(cl_compact.num_sweeps_since_reset, 0u);
+
+    // dE and energy are recomputed every reset_interval sweeps
+    const auto long_schedule_list = utility::make_classical_schedule_list(0.1, 10.0, 10, 15);
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_compact, engine_compact, long_schedule_list);
+    EXPECT_EQ(cl_compact.num_sweeps_since_reset, 150 % cl_compact.reset_interval);
+    EXPECT_NEAR(cl_compact.energy, dense.calc_energy(result::get_solution(cl_compact)), 1e-5);
+}
+
+TEST(ClassicalIsing, ReplicaPackedTracksEnergy){
+    using namespace openjij;
+    const auto dense = generate_interaction<graph::Dense<double>>();
+    const auto schedule_list = utility::make_classical_schedule_list(0.1, 10.0, 5, 5);
+
+    auto engine_for_spin = std::mt19937(1);
+    std::vector<graph::Spins> spins;
+    for (std::size_t r = 0; r < 3; ++r) {
+        spins.push_back(dense.gen_spin(engine_for_spin));
+    }
+
+    // a single replica follows ClassicalIsing for the same random numbers
+    auto cl_dense = system::make_classical_ising(spins[0], dense);
+    auto cl_single = system::make_replica_packed_classical_ising(std::vector<graph::Spins>{spins[0]}, dense);
+    auto engine_dense = std::mt19937(2);
+    auto engine_single = std::mt19937(2);
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_dense, engine_dense, schedule_list);
+    algorithm::Algorithm<updater::SingleSpinFlip>::run(cl_single, engine_single, schedule_list);
+    EXPECT_EQ(result::get_solution(cl_dense), result::get_solution(cl_single)[0]);
+
+    // the rank-1 updates keep the local fields and the energies of every replica
+    auto cl_packed = system::make_replica_packed_classical_ising(spins, dense);
+    for (std::size_t r = 0; r < spins.size(); ++r) {
+        EXPECT_NEAR(cl_packed.energy(r), dense.calc_energy(spins[r]), 1e-10);
+    }
+    auto engine_packed = std::mt19937(3);
+    algorithm::Algorithm<updater::FastSingleSpinFlip>::run(cl_packed, engine_packed, schedule_list);
+    const auto solutions = result::get_solution(cl_packed);
+    const auto energies = result::get_energy(cl_packed);
+    ASSERT_EQ(solutions.size(), spins.size());
+    for (std::size_t r = 0; r < spins.size(); ++r) {
+        EXPECT_NEAR(energies[r], dense.calc_energy(solutions[r]), 1e-10);
+    }
+    const auto local_field = cl_packed.local_field;
+    cl_packed.reset_dE();
+    EXPECT_TRUE(local_field.isApprox(cl_packed.local_field, 1e-10));
+
+    EXPECT_THROW(cl_packed.reset_spins(std::vector<graph::Spins>{spins[0]}), std::runtime_error);
+    EXPECT_THROW(system::make_replica_packed_classical_ising(std::vector<graph::Spins>{}, dense), std::runtime_error);
+}
+
 }
 }
@@ -250,5 +250,38 @@ TEST(System, IsingPolynomialSystemExplicitLinearPolyPart2) {
 
 
 
+TEST(System, IsingPolynomialSystemEnergy) {
+   using IPM = graph::IsingPolynomialModel<double>;
+   
+   std::vector<std::vector<typename IPM::IndexType>> key_list = {
+      {0, 1, 2},
+      {0},
+      {1, 3},
+      {2, 3, 4},
+      {},
+      {4, 0}
+   };
+   
+   std::vector<double> value_list = {
+      +4.0,
+      +2.0,
+      -3.0,
+      -1.5,
+      +0.5,
+      -2.5
+   };
+   
+   const auto model = IPM{key_list, value_list};
+   auto sa_system = system::SASystem<IPM, std::mt19937>{model, 1};
+   EXPECT_DOUBLE_EQ(sa_system.GetEnergy(), model.CalculateEnergy(sa_system.ExtractSample()));
+   
+   std::mt19937 random_number_engine(2);
+   std::uniform_int_distribution<std::int32_t> dist(0, sa_system.GetSystemSize() - 1);
+   for (std::int32_t i = 0; i < 100; ++i) {
+      sa_system.Flip(dist(random_number_engine));
+      EXPECT_DOUBLE_EQ(sa_system.GetEnergy(), model.CalculateEnergy(sa_system.ExtractSample()));
+   }
+}
+
 }
 }
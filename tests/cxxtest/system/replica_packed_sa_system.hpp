@@ -0,0 +1,114 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+
+namespace openjij {
+namespace test {
+
+template<class ModelType>
+void TestReplicaPackedEnergyDifference(const ModelType &model, const std::int32_t num_replicas) {
+   using PackedSystem = system::ReplicaPackedSASystem<ModelType, std::mt19937>;
+   using System = system::SASystem<ModelType, std::mt19937>;
+   
+   auto packed_system = PackedSystem{model, num_replicas, 1};
+   auto sa_system = System{model, 1};
+   std::mt19937_64 random_number_engine(2);
+   
+   EXPECT_EQ(packed_system.GetNumReplicas(), num_replicas);
+   EXPECT_EQ(packed_system.GetSystemSize(), model.GetSystemSize());
+   
+   for (std::int32_t step = 0; step < 20; ++step) {
+      for (std::int32_t i = 0; i < packed_system.GetSystemSize(); ++i) {
+         const auto delta_energy = packed_system.GetEnergyDifference(i);
+         for (std::int32_t r = 0; r < num_replicas; ++r) {
+            sa_system.SetSample(packed_system.ExtractSample(r));
+            EXPECT_NEAR(delta_energy[r], sa_system.GetEnergyDifference(i), 1e-10);
+         }
+      }
+      packed_system.Flip(step%packed_system.GetSystemSize(), random_number_engine());
+   }
+   
+   // Setting the variables of a replica leaves the others intact
+   const auto sample = sa_system.ExtractSample();
+   const auto other_sample = packed_system.ExtractSample(num_replicas - 1);
+   packed_system.SetSample(0, sample);
+   EXPECT_EQ(packed_system.ExtractSample(0), sample);
+   if (num_replicas > 1) {
+      EXPECT_EQ(packed_system.ExtractSample(num_replicas - 1), other_sample);
+   }
+   sa_system.SetSample(sample);
+   for (std::int32_t i = 0; i < packed_system.GetSystemSize(); ++i) {
+      EXPECT_NEAR(packed_system.GetEnergyDifference(i)[0], sa_system.GetEnergyDifference(i), 1e-10);
+   }
+   EXPECT_THROW(packed_system.SetSample(num_replicas, sample), std::runtime_error);
+}
+
+TEST(System, ReplicaPackedIsingPolynomialSystemEnergyDifference) {
+   using IPM = graph::IsingPolynomialModel<double>;
+   
+   std::vector<std::vector<typename IPM::IndexType>> key_list = {
+      {0, 1, 2, 3},
+      {0},
+      {1, 2},
+      {0, 2, 3},
+      {3},
+      {1, 3}
+   };
+   
+   std::vector<double> value_list = {
+      +4.0,
+      +2.0,
+      +3.0,
+      -1.0,
+      -1.5,
+      -2.5
+   };
+   
+   const auto ipm = IPM{key_list, value_list};
+   TestReplicaPackedEnergyDifference(ipm, 64);
+   TestReplicaPackedEnergyDifference(ipm, 5);
+   EXPECT_THROW((system::ReplicaPackedSASystem<IPM, std::mt19937>{ipm, 65, 1}), std::runtime_error);
+}
+
+TEST(System, ReplicaPackedBinaryPolynomialSystemEnergyDifference) {
+   using BPM = graph::BinaryPolynomialModel<double>;
+   
+   std::vector<std::vector<typename BPM::IndexType>> key_list = {
+      {0, 1, 2, 3},
+      {0},
+      {1, 2},
+      {0, 2, 3},
+      {3},
+      {1, 3}
+   };
+   
+   std::vector<double> value_list = {
+      +4.0,
+      +2.0,
+      +3.0,
+      -1.0,
+      -1.5,
+      -2.5
+   };
+   
+   const auto bpm = BPM{key_list, value_list};
+   TestReplicaPackedEnergyDifference(bpm, 64);
+   TestReplicaPackedEnergyDifference(bpm, 5);
+   EXPECT_THROW((system::ReplicaPackedSASystem<BPM, std::mt19937>{bpm, 0, 1}), std::runtime_error);
+}
+
+}
+}
@@ -16,5 +16,12 @@
 
 #include "eigen.hpp"
 #include "union_find.hpp"
+#include "graph_coloring.hpp"
+#include "simd.hpp"
+#include "fenwick_tree.hpp"
+#include "packed_sample_store.hpp"
+#include "schedule_list.hpp"
+#include "random.hpp"
 #include "gpu.hpp"
 #include "min_polynomial.hpp"
+#include "fast_exp.hpp"
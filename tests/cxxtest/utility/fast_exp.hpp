@@ -0,0 +1,60 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+namespace openjij {
+namespace test {
+
+TEST(FastExp, Accuracy) {
+   for (double x = -50.0; x <= 0.0; x += 0.01) {
+      EXPECT_NEAR(utility::fast_exp(x)/std::exp(x), 1.0, 1e-12);
+   }
+}
+
+TEST(FastExp, AcceptanceCutoff) {
+   auto random_number_engine = std::mt19937(1);
+   auto dist = std::uniform_real_distribution<double>(0, 1);
+   
+   // hopeless moves are rejected without drawing random numbers
+   const auto state = random_number_engine;
+   EXPECT_FALSE(utility::metropolis_accept<true>(1.0, utility::FAST_EXP_CUTOFF<double> + 1.0, dist, random_number_engine));
+   EXPECT_FALSE(utility::heat_bath_accept<true>(utility::FAST_EXP_CUTOFF<double> + 1.0, dist, random_number_engine));
+   EXPECT_TRUE(utility::heat_bath_accept<true>(-utility::FAST_EXP_CUTOFF<double> - 1.0, dist, random_number_engine));
+   EXPECT_TRUE(random_number_engine == state);
+   
+   EXPECT_TRUE(utility::metropolis_accept<true>(1.0, -1.0, dist, random_number_engine));
+   EXPECT_TRUE(utility::metropolis_accept<false>(1.0, -1.0, dist, random_number_engine));
+   
+   // the default mode draws a random number for every uphill move, even at
+   // beta = 0, as the plain std::exp test does
+   auto reference_engine = random_number_engine;
+   auto reference_dist = dist;
+   EXPECT_TRUE(utility::metropolis_accept<false>(0.0, 1.0, dist, random_number_engine));
+   EXPECT_TRUE(std::exp(-0.0*1.0) > reference_dist(reference_engine));
+   EXPECT_TRUE(random_number_engine == reference_engine);
+
+   // the acceptance rate of both modes agrees
+   std::int32_t fast_count = 0;
+   std::int32_t count = 0;
+   for (std::int32_t i = 0; i < 100000; ++i) {
+      fast_count += utility::metropolis_accept<true>(1.0, 1.0, dist, random_number_engine);
+      count += utility::metropolis_accept<false>(1.0, 1.0, dist, random_number_engine);
+   }
+   EXPECT_NEAR(fast_count/100000.0, std::exp(-1.0), 0.01);
+   EXPECT_NEAR(count/100000.0, std::exp(-1.0), 0.01);
+}
+
+}
+}
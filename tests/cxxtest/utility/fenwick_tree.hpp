@@ -0,0 +1,61 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+
+namespace openjij {
+namespace test {
+
+TEST(FenwickTree, TotalAndFindFollowWeights) {
+    auto tree = utility::FenwickTree<double>(5);
+    tree.assign({1.0, 0.0, 2.0, 0.5, 0.0});
+
+    EXPECT_DOUBLE_EQ(tree.total(), 3.5);
+    EXPECT_EQ(tree.find(0.0), 0);
+    EXPECT_EQ(tree.find(0.99), 0);
+    EXPECT_EQ(tree.find(1.0), 2);
+    EXPECT_EQ(tree.find(2.99), 2);
+    EXPECT_EQ(tree.find(3.0), 3);
+    // out of range values fall back to the last positive weight
+    EXPECT_EQ(tree.find(3.5), 3);
+
+    tree.set(2, 0.0);
+    tree.set(4, 1.0);
+    EXPECT_DOUBLE_EQ(tree.total(), 2.5);
+    EXPECT_DOUBLE_EQ(tree.get(4), 1.0);
+    EXPECT_EQ(tree.find(1.0), 3);
+    EXPECT_EQ(tree.find(1.5), 4);
+}
+
+TEST(FenwickTree, SetAgreesWithRebuild) {
+    auto random_number_engine = std::mt19937(1);
+    auto dist = std::uniform_real_distribution<double>(0, 1);
+    auto tree = utility::FenwickTree<double>(37);
+
+    for (std::size_t i = 0; i < 1000; ++i) {
+        tree.set(i % 37, dist(random_number_engine));
+    }
+    auto rebuilt = tree;
+    rebuilt.rebuild();
+
+    EXPECT_NEAR(tree.total(), rebuilt.total(), 1e-10);
+    for (std::size_t i = 0; i < 100; ++i) {
+        const double value = dist(random_number_engine)*rebuilt.total();
+        EXPECT_EQ(tree.find(value), rebuilt.find(value));
+    }
+}
+
+}
+}
@@ -0,0 +1,61 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+
+namespace openjij {
+namespace test {
+
+TEST(GraphColoring, NeighborsHaveDifferentColors) {
+    // Cycle of five vertices with a chord from 0 to 2
+    const std::vector<std::vector<std::int32_t>> neighbor_list = {
+        {1, 2, 4}, {0, 2}, {0, 1, 3}, {2, 4}, {3, 0}
+    };
+    const auto color_list = openjij::utility::GreedyColoring(neighbor_list);
+    EXPECT_EQ(color_list.size(), 3);
+
+    std::vector<std::int32_t> color(neighbor_list.size(), -1);
+    for (std::size_t c = 0; c < color_list.size(); ++c) {
+        for (const auto v : color_list[c]) {
+            EXPECT_EQ(color[v], -1);
+            color[v] = static_cast<std::int32_t>(c);
+        }
+    }
+    for (std::size_t v = 0; v < neighbor_list.size(); ++v) {
+        EXPECT_NE(color[v], -1);
+        for (const auto u : neighbor_list[v]) {
+            EXPECT_NE(color[v], color[u]);
+        }
+    }
+}
+
+TEST(GraphColoring, BipartiteGraphHasTwoColors) {
+    // Path of six vertices
+    std::vector<std::vector<std::int64_t>> neighbor_list(6);
+    for (std::int64_t v = 0; v < 5; ++v) {
+        neighbor_list[v].push_back(v + 1);
+        neighbor_list[v + 1].push_back(v);
+    }
+    const auto color_list = openjij::utility::GreedyColoring(neighbor_list);
+    const std::vector<std::vector<std::int64_t>> expect = {{1, 3, 5}, {0, 2, 4}};
+    EXPECT_EQ(color_list, expect);
+
+    // Isolated vertices share one color
+    const auto isolated = openjij::utility::GreedyColoring(std::vector<std::vector<std::int64_t>>(3));
+    EXPECT_EQ(isolated, (std::vector<std::vector<std::int64_t>>{{0, 1, 2}}));
+}
+
+}
+}
@@ -0,0 +1,81 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+
+namespace openjij {
+namespace test {
+
+TEST(PackedSampleStore, MergesIdenticalSamples) {
+    // 70 variables span two words
+    const std::size_t system_size = 70;
+    auto store = utility::PackedSampleStore<std::int8_t, double>(system_size, 4, -1, 1);
+    EXPECT_EQ(store.num_words(), 2);
+
+    std::vector<std::int8_t> a(system_size, -1);
+    std::vector<std::int8_t> b(system_size, -1);
+    a[3] = 1;
+    a[69] = 1;
+    b[3] = 1;
+
+    const auto [row_a, inserted_a] = store.insert(a);
+    const auto [row_b, inserted_b] = store.insert(b);
+    const auto [row_c, inserted_c] = store.insert(a);
+    EXPECT_TRUE(inserted_a);
+    EXPECT_TRUE(inserted_b);
+    EXPECT_FALSE(inserted_c);
+    EXPECT_EQ(row_c, row_a);
+    store.set_energy(row_a, -1.5);
+
+    EXPECT_EQ(store.num_samples(), 3);
+    EXPECT_EQ(store.unique_row_list(), (std::vector<std::size_t>{row_a, row_b}));
+    EXPECT_EQ(store.num_occurrences(row_a), 2);
+    EXPECT_EQ(store.num_occurrences(row_b), 1);
+    EXPECT_DOUBLE_EQ(store.energy(row_a), -1.5);
+    EXPECT_EQ(store.sample(row_a), a);
+    EXPECT_EQ(store.sample(row_b), b);
+
+    EXPECT_THROW(store.insert(std::vector<std::int8_t>(3, 1)), std::runtime_error);
+    store.insert(b);
+    EXPECT_THROW(store.insert(b), std::runtime_error);
+}
+
+TEST(PackedSampleStore, ConcurrentInsertion) {
+    const std::size_t system_size = 10;
+    const std::int32_t num_samples = 4000;
+    auto store = utility::PackedSampleStore<std::int8_t, double>(system_size, num_samples, 0, 1);
+
+#pragma omp parallel for num_threads(4)
+    for (std::int32_t i = 0; i < num_samples; ++i) {
+        // 50 distinct samples
+        std::vector<std::int8_t> sample(system_size);
+        for (std::size_t k = 0; k < system_size; ++k) {
+            sample[k] = ((i % 50) >> k) & 1;
+        }
+        store.insert(sample);
+    }
+
+    const auto row_list = store.unique_row_list();
+    EXPECT_EQ(row_list.size(), 50);
+    std::int32_t total = 0;
+    for (const auto row: row_list) {
+        EXPECT_EQ(store.num_occurrences(row), num_samples/50);
+        total += store.num_occurrences(row);
+    }
+    EXPECT_EQ(total, num_samples);
+}
+
+}
+}
@@ -0,0 +1,222 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+namespace openjij {
+namespace test {
+
+TEST(Random, SplitMix64) {
+   // Reference output of splitmix64 with the seed 1234567
+   utility::SplitMix64 random_number_engine(1234567);
+   EXPECT_EQ(random_number_engine(), 6457827717110365317ULL);
+   EXPECT_EQ(random_number_engine(), 3203168211198807973ULL);
+   
+   // Derived seeds differ among streams and do not depend on the order of creation
+   EXPECT_NE(utility::DeriveSeed(3, 0), utility::DeriveSeed(3, 1));
+   EXPECT_NE(utility::DeriveSeed(3, 1), utility::DeriveSeed(4, 0));
+   EXPECT_EQ(utility::DeriveSeed(3, 5), utility::DeriveSeed(3, 5));
+}
+
+TEST(Random, Philox4x32) {
+   using Block = utility::Philox4x32::Block;
+   
+   // Known answers of Philox4x32-10
+   EXPECT_EQ(utility::Philox4x32::block(0, 0, 0), (Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+   EXPECT_EQ(utility::Philox4x32::block(UINT64_MAX, UINT64_MAX, UINT64_MAX), (Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+   EXPECT_EQ(utility::Philox4x32::block(0x299f31d0a4093822ULL, 0x0370734413198a2eULL, 0x85a308d3243f6a88ULL),
+             (Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+   
+   // The engine walks through the blocks of its stream
+   utility::Philox4x32 random_number_engine(7, 2);
+   std::vector<std::uint64_t> value_list(6);
+   for (auto &value: value_list) {
+      value = random_number_engine();
+   }
+   for (std::uint64_t position = 0; position < 3; ++position) {
+      const Block block = utility::Philox4x32::block(7, 2, position);
+      EXPECT_EQ(value_list[2*position], (std::uint64_t(block[1]) << 32 | block[0]));
+      EXPECT_EQ(value_list[2*position + 1], (std::uint64_t(block[3]) << 32 | block[2]));
+   }
+   
+   // Random access within the stream
+   utility::Philox4x32 seeked(7, 2);
+   seeked.seek(1);
+   EXPECT_EQ(seeked(), value_list[2]);
+   utility::Philox4x32 discarded(7, 2);
+   discarded();
+   discarded.discard(3);
+   EXPECT_EQ(discarded(), value_list[4]);
+   
+   // Other streams are different
+   EXPECT_NE(utility::Philox4x32(7, 3)(), value_list[0]);
+   EXPECT_NE(utility::Philox4x32(8, 2)(), value_list[0]);
+}
+
+TEST(Random, Xoshiro256pp) {
+   // Each lane is the reference xoshiro256++ seeded with four numbers of splitmix64
+   utility::SplitMix64 seed_engine(11);
+   std::vector<std::array<std::uint64_t, 4>> state_list(utility::Xoshiro256pp::num_lanes);
+   for (auto &state: state_list) {
+      for (auto &word: state) {
+         word = seed_engine();
+      }
+   }
+   const auto rotl = [](const std::uint64_t x, const int k) {
+      return (x << k) | (x >> (64 - k));
+   };
+   
+   utility::Xoshiro256pp random_number_engine(11);
+   for (std::int32_t block = 0; block < 3; ++block) {
+      for (auto &s: state_list) {
+         const std::uint64_t expected = rotl(s[0] + s[3], 23) + s[0];
+         const std::uint64_t t = s[1] << 17;
+         s[2] ^= s[0];
+         s[3] ^= s[1];
+         s[1] ^= s[2];
+         s[0] ^= s[3];
+         s[2] ^= t;
+         s[3] = rotl(s[3], 45);
+         EXPECT_EQ(random_number_engine(), expected);
+      }
+   }
+   
+   // Filling an array gives the same numbers as drawing them one by one
+   utility::Xoshiro256pp engine_a(5);
+   utility::Xoshiro256pp engine_b(5);
+   engine_a();
+   engine_b();
+   std::vector<double> filled(29);
+   utility::UniformRealDistribution<double> dist;
+   dist.fill(engine_a, filled.data(), filled.size());
+   for (const auto value: filled) {
+      EXPECT_EQ(value, dist(engine_b));
+      EXPECT_GE(value, 0.0);
+      EXPECT_LT(value, 1.0);
+   }
+   std::vector<float> filled_float(13);
+   engine_a.fill_uniform(filled_float.data(), filled_float.size());
+   for (const auto value: filled_float) {
+      EXPECT_EQ(value, engine_b.uniform<float>());
+      EXPECT_GE(value, 0.0f);
+      EXPECT_LT(value, 1.0f);
+   }
+   
+   // A long array spanning several chunks matches the numbers drawn one by one
+   std::vector<double> long_filled(1000);
+   dist.fill(engine_a, long_filled.data(), long_filled.size());
+   for (const auto value: long_filled) {
+      EXPECT_EQ(value, dist(engine_b));
+   }
+}
+
+TEST(Random, Xoshiro256ppSimdLevel) {
+   // Every instruction set supported by the CPU generates the same blocks as the scalar loop
+   std::vector<utility::SimdLevel> level_list = {utility::SimdLevel::SCALAR};
+   if (utility::simd_level() != utility::SimdLevel::SCALAR) {
+      level_list.push_back(utility::SimdLevel::AVX2);
+   }
+   if (utility::simd_level() == utility::SimdLevel::AVX512) {
+      level_list.push_back(utility::SimdLevel::AVX512);
+   }
+   
+   constexpr std::size_t num_lanes = utility::Xoshiro256pp::num_lanes;
+   std::vector<std::vector<std::uint64_t>> result_list;
+   for (const auto level: level_list) {
+      utility::SplitMix64 seed_engine(3);
+      alignas(64) std::uint64_t state[4][num_lanes];
+      for (std::size_t k = 0; k < 4; ++k) {
+         for (std::size_t lane = 0; lane < num_lanes; ++lane) {
+            state[k][lane] = seed_engine();
+         }
+      }
+      std::vector<std::uint64_t> result(7*num_lanes);
+      utility::xoshiro_detail::generate(level, state, result.data(), 5);
+      utility::xoshiro_detail::generate(level, state, result.data() + 5*num_lanes, 2);
+      result_list.push_back(result);
+   }
+   for (const auto &result: result_list) {
+      EXPECT_EQ(result, result_list.front());
+   }
+}
+
+TEST(Random, PCG64) {
+   // Reference output of pcg64 with the seed 42 and the stream 54
+   utility::PCG64 random_number_engine(42, 54);
+   const std::vector<std::uint64_t> expected_list = {
+      0x86b1da1d72062b68ULL, 0x1304aa46c9853d39ULL, 0xa3670e9e0dd50358ULL,
+      0xf9090e529a7dae00ULL, 0xc85b9fd837996f2cULL, 0x606121f8e3919196ULL
+   };
+   for (const auto expected: expected_list) {
+      EXPECT_EQ(random_number_engine(), expected);
+   }
+   EXPECT_NE(utility::PCG64(42, 55)(), expected_list[0]);
+}
+
+TEST(Random, DispatchRandomNumberEngine) {
+   using algorithm::RandomNumberEngine;
+   
+   const auto get_index = [](const RandomNumberEngine random_number_engine) {
+      return algorithm::GenerateRandomNumberEngineClass(random_number_engine, 1).index();
+   };
+   EXPECT_EQ(get_index(RandomNumberEngine::XORSHIFT), 0);
+   EXPECT_EQ(get_index(RandomNumberEngine::MT), 1);
+   EXPECT_EQ(get_index(RandomNumberEngine::MT_64), 2);
+   EXPECT_EQ(get_index(RandomNumberEngine::PHILOX), 3);
+   EXPECT_EQ(get_index(RandomNumberEngine::XOSHIRO), 4);
+   EXPECT_EQ(get_index(RandomNumberEngine::PCG64), 5);
+   
+   // The engine is constructed with the seed
+   auto variant = algorithm::GenerateRandomNumberEngineClass(RandomNumberEngine::MT_64, 7);
+   EXPECT_EQ(std::get<std::mt19937_64>(variant)(), std::mt19937_64(7)());
+   
+   const bool is_mt_64 = algorithm::DispatchRandomNumberEngine(RandomNumberEngine::MT_64, [](auto tag) {
+      return std::is_same<typename decltype(tag)::type, std::mt19937_64>::value;
+   });
+   EXPECT_TRUE(is_mt_64);
+   EXPECT_THROW(algorithm::GenerateRandomNumberEngineClass(static_cast<RandomNumberEngine>(-1)), std::runtime_error);
+}
+
+TEST(Random, ErasedRandomNumberEngine) {
+   using algorithm::RandomNumberEngine;
+   
+   const auto is_erased = [](const RandomNumberEngine random_number_engine) {
+      return algorithm::DispatchErasedRandomNumberEngine(random_number_engine, [](auto tag) {
+         return std::is_same<typename decltype(tag)::type, algorithm::ErasedRandomNumberEngine>::value;
+      });
+   };
+   EXPECT_FALSE(is_erased(RandomNumberEngine::XORSHIFT));
+   EXPECT_FALSE(is_erased(RandomNumberEngine::MT));
+   EXPECT_FALSE(is_erased(RandomNumberEngine::MT_64));
+   EXPECT_TRUE(is_erased(RandomNumberEngine::PHILOX));
+   EXPECT_TRUE(is_erased(RandomNumberEngine::XOSHIRO));
+   EXPECT_TRUE(is_erased(RandomNumberEngine::PCG64));
+   
+   // The stream is that of the held engine across the blocks
+   const auto check_stream = [](const RandomNumberEngine random_number_engine, auto reference) {
+      auto erased = algorithm::MakeRandomNumberEngine<algorithm::ErasedRandomNumberEngine>(random_number_engine, 3);
+      for (std::size_t i = 0; i < 3*algorithm::ErasedRandomNumberEngine::BLOCK_SIZE + 5; ++i) {
+         EXPECT_EQ(erased(), reference());
+      }
+   };
+   check_stream(RandomNumberEngine::PHILOX, utility::Philox4x32(3));
+   check_stream(RandomNumberEngine::XOSHIRO, utility::Xoshiro256pp(3));
+   check_stream(RandomNumberEngine::PCG64, utility::PCG64(3));
+   
+   EXPECT_EQ(algorithm::MakeRandomNumberEngine<std::mt19937>(RandomNumberEngine::MT, 7)(), std::mt19937(7)());
+   EXPECT_THROW(algorithm::MakeRandomNumberEngine<algorithm::ErasedRandomNumberEngine>(RandomNumberEngine::MT, 7), std::runtime_error);
+}
+
+} // namespace test
+} // namespace openjij
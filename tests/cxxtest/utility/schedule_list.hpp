@@ -0,0 +1,61 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+namespace openjij {
+namespace test {
+
+TEST(ScheduleList, GenerateBetaList) {
+   using utility::TemperatureSchedule;
+   
+   for (const auto schedule: {TemperatureSchedule::LINEAR, TemperatureSchedule::GEOMETRIC,
+                              TemperatureSchedule::POWER_LAW, TemperatureSchedule::EXPONENTIAL_PLATEAU}) {
+      const auto beta_list = utility::GenerateBetaList(schedule, 0.1, 10.0, 11);
+      ASSERT_EQ(beta_list.size(), 11);
+      EXPECT_NEAR(beta_list.front(), 0.1, 1e-10);
+      EXPECT_NEAR(beta_list.back(), 10.0, 1e-10);
+      EXPECT_TRUE(std::is_sorted(beta_list.begin(), beta_list.end()));
+   }
+   
+   // The power law with the exponent one is linear
+   const auto linear = utility::GenerateBetaList(TemperatureSchedule::LINEAR, 0.1, 10.0, 11);
+   const auto power_law = utility::GenerateBetaList(TemperatureSchedule::POWER_LAW, 0.1, 10.0, 11, 1.0);
+   for (std::size_t i = 0; i < linear.size(); ++i) {
+      EXPECT_NEAR(power_law[i], linear[i], 1e-10);
+   }
+   const auto quadratic = utility::GeneratePowerLawBetaSchedule(0.0, 4.0, 3, 2.0);
+   EXPECT_NEAR(quadratic[1], 1.0, 1e-10);
+   
+   // The last plateau_ratio of the sweeps stay at beta_max
+   const auto plateau = utility::GenerateExponentialPlateauBetaSchedule(1.0, 16.0, 10, 0.5);
+   const auto geometric = utility::GenerateGeometricBetaSchedule(1.0, 16.0, 5);
+   for (std::size_t i = 0; i < 5; ++i) {
+      EXPECT_NEAR(plateau[i], geometric[i], 1e-10);
+      EXPECT_NEAR(plateau[5 + i], 16.0, 1e-10);
+   }
+   
+   EXPECT_THROW(utility::GeneratePowerLawBetaSchedule(0.1, 10.0, 10, 0.0), std::runtime_error);
+   EXPECT_THROW(utility::GenerateExponentialPlateauBetaSchedule(0.1, 10.0, 10, 1.0), std::runtime_error);
+}
+
+TEST(ScheduleList, RepeatBetaList) {
+   const auto beta_list = utility::RepeatBetaList<double>({0.5, 2.0, 1.0}, {2, 1, 3});
+   EXPECT_EQ(beta_list, std::vector<double>({0.5, 0.5, 2.0, 1.0, 1.0, 1.0}));
+   EXPECT_THROW(utility::RepeatBetaList<double>({0.5, 2.0}, {1}), std::runtime_error);
+   EXPECT_THROW(utility::RepeatBetaList<double>({0.5}, {0}), std::runtime_error);
+}
+
+} // namespace test
+} // namespace openjij
@@ -0,0 +1,73 @@
+//    Copyright 2023 Jij Inc.
+
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+
+//        http://www.apache.org/licenses/LICENSE-2.0
+
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+
+#pragma once
+
+
+namespace openjij {
+namespace test {
+
+TEST(SIMD, BFloat16RoundsToNearestEven) {
+    using openjij::utility::BFloat16;
+    EXPECT_EQ(static_cast<float>(BFloat16(1.0f)), 1.0f);
+    EXPECT_EQ(static_cast<float>(BFloat16(-2.5f)), -2.5f);
+    // 1 + 2^-8 is halfway between 1 and 1 + 2^-7, and rounds to the even 1
+    EXPECT_EQ(static_cast<float>(BFloat16(1.00390625f)), 1.0f);
+    EXPECT_EQ(static_cast<float>(BFloat16(1.01171875f)), 1.015625f);
+    EXPECT_NEAR(static_cast<float>(BFloat16(0.1f)), 0.1f, 1e-3);
+    EXPECT_TRUE(std::isnan(static_cast<float>(BFloat16(std::nanf("")))));
+}
+
+template<typename StorageType>
+void check_spin_axpy() {
+    std::mt19937 engine(1);
+    std::uniform_real_distribution<float> dist(-2, 2);
+    std::vector<openjij::utility::SimdLevel> level_list = {openjij::utility::SimdLevel::SCALAR};
+    if (openjij::utility::simd_level() != openjij::utility::SimdLevel::SCALAR) {
+        level_list.push_back(openjij::utility::SimdLevel::AVX2);
+    }
+    if (openjij::utility::simd_level() == openjij::utility::SimdLevel::AVX512) {
+        level_list.push_back(openjij::utility::SimdLevel::AVX512);
+    }
+
+    // The sizes include the tails of both vector widths
+    for (const std::size_t size: {1, 7, 8, 16, 37}) {
+        std::vector<StorageType> row(size);
+        std::vector<std::int8_t> spin(size);
+        std::vector<float> y(size);
+        for (std::size_t j = 0; j < size; ++j) {
+            row[j] = StorageType(dist(engine));
+            spin[j] = dist(engine) > 0 ? 1 : -1;
+            y[j] = dist(engine);
+        }
+        for (const auto level: level_list) {
+            auto result = y;
+            openjij::utility::spin_axpy(level, -4.0f, row.data(), spin.data(), result.data(), size);
+            for (std::size_t j = 0; j < size; ++j) {
+                EXPECT_NEAR(result[j], y[j] - 4.0f * openjij::utility::to_float(row[j]) * spin[j], 1e-5);
+            }
+        }
+    }
+}
+
+TEST(SIMD, SpinAxpyFloat) {
+    check_spin_axpy<float>();
+}
+
+TEST(SIMD, SpinAxpyBFloat16) {
+    check_spin_axpy<openjij::utility::BFloat16>();
+}
+
+}
+}
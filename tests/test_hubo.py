@@ -31,8 +31,8 @@ class HUBOTest(unittest.TestCase):
     def test_SASampler_hubo_spin_1(self):
         K, true_energy = self.gen_testcase_polynomial()
 
-        update_method_list = ["METROPOLIS", "HEAT_BATH"]
-        random_number_engine_list = ["XORSHIFT", "MT", "MT_64"]
+        update_method_list = ["METROPOLIS", "HEAT_BATH", "REJECTION_FREE"]
+        random_number_engine_list = ["XORSHIFT", "MT", "MT_64", "PHILOX", "XOSHIRO", "PCG64"]
         temperature_schedule_list = ["GEOMETRIC", "LINEAR"]
 
         for update_method in update_method_list:
@@ -72,8 +72,8 @@ class HUBOTest(unittest.TestCase):
         K[2,3,4] = +0.9
         true_energy = -15.1
 
-        update_method_list = ["METROPOLIS", "HEAT_BATH"]
-        random_number_engine_list = ["XORSHIFT", "MT", "MT_64"]
+        update_method_list = ["METROPOLIS", "HEAT_BATH", "REJECTION_FREE"]
+        random_number_engine_list = ["XORSHIFT", "MT", "MT_64", "PHILOX", "XOSHIRO", "PCG64"]
         temperature_schedule_list = ["GEOMETRIC", "LINEAR"]
 
         for update_method in update_method_list:
@@ -114,8 +114,8 @@ class HUBOTest(unittest.TestCase):
         K[2,3,4] = +0.9
         true_energy = -3.1
 
-        update_method_list = ["METROPOLIS", "HEAT_BATH"]
-        random_number_engine_list = ["XORSHIFT", "MT", "MT_64"]
+        update_method_list = ["METROPOLIS", "HEAT_BATH", "REJECTION_FREE"]
+        random_number_engine_list = ["XORSHIFT", "MT", "MT_64", "PHILOX", "XOSHIRO", "PCG64"]
         temperature_schedule_list = ["GEOMETRIC", "LINEAR"]
 
         for update_method in update_method_list:
@@ -201,6 +201,27 @@ class HUBOTest(unittest.TestCase):
         response = oj.SASampler().sample_hubo(bpm_ci, seed = 3, updater="k-local")
         self.assertAlmostEqual(true_energy, response.energies[0])
     
+    def test_SASampler_hubo_warm_start(self):
+        K = {("a", "b"): -1, ("b", "c"): -1, ("a",): -1}
+        ground_state = {"a": 1, "b": 1, "c": 1}
+
+        # At beta = 0 every variable of the initial state is flipped in a sweep
+        response = oj.SASampler().sample_hubo(
+            K, vartype="SPIN", num_reads=3, seed=3,
+            initial_states=ground_state, beta_schedule=[0.0])
+        for sample in response.samples():
+            self.assertEqual(dict(sample), {"a": -1, "b": -1, "c": -1})
+
+        # Reverse annealing: reheat the initial state and re-cool it
+        response = oj.SASampler().sample_hubo(
+            K, vartype="SPIN", num_reads=3, seed=3,
+            initial_states=[ground_state], beta_schedule=[10.0, 0.5] + [10.0]*50)
+        for energy in response.energies:
+            self.assertAlmostEqual(energy, -3)
+
+        with self.assertRaises(ValueError):
+            oj.SASampler().sample_hubo(K, vartype="SPIN", initial_states={"a": 1})
+
     def test_hubo_constructor(self):
         hubo_spin = oj.BinaryPolynomialModel(self.J_quad, oj.SPIN)
         self.assertEqual(hubo_spin.vartype, oj.SPIN)
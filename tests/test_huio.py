@@ -8,7 +8,7 @@ class HUIOTest(unittest.TestCase):
 
     def setUp(self):
         self.upd = ["METROPOLIS", "OPT_METROPOLIS", "HEAT_BATH", "SUWA_TODO"]
-        self.ran = ["XORSHIFT", "MT", "MT_64"]
+        self.ran = ["XORSHIFT", "MT", "MT_64", "PHILOX", "XOSHIRO", "PCG64"]
         self.sch = ["GEOMETRIC", "LINEAR"]
         self.seed = 42
         random.seed(self.seed)
@@ -8,7 +8,7 @@ class QUIOTest(unittest.TestCase):
 
     def setUp(self):
         self.upd = ["METROPOLIS", "OPT_METROPOLIS", "HEAT_BATH", "SUWA_TODO"]
-        self.ran = ["XORSHIFT", "MT", "MT_64"]
+        self.ran = ["XORSHIFT", "MT", "MT_64", "PHILOX", "XOSHIRO", "PCG64"]
         self.sch = ["GEOMETRIC", "LINEAR"]
         self.seed = 42
         random.seed(self.seed)
@@ -72,6 +72,65 @@ class QUIOTest(unittest.TestCase):
             self.assertAlmostEqual(r.first.energy, -2)
             self.assertEqual(r.first.sample, {0: -1, 1: -1, 2: 1})
 
+    def test_quio_stopping_criteria(self):
+        Q = {(i,): -1.0 for i in range(100)}
+        bound_list = {i: (-2, 2) for i in range(100)}
+
+        r = oj.SASampler().sample_quio(Q, bound_list=bound_list, num_reads=8,
+                                       num_sweeps=1000000, num_threads=1,
+                                       time_limit=0.05, seed=self.seed)
+        self.assertEqual(len(r.record.sample), 1)
+
+        r = oj.SASampler().sample_quio(Q, bound_list=bound_list, num_reads=4,
+                                       num_sweeps=1000000, target_energy=-50,
+                                       log_history=True, seed=self.seed)
+        self.assertEqual(len(r.record.sample), 4)
+        for energy, history in zip(r.record.energy, r.info["log"]["energy_history"]):
+            self.assertLessEqual(energy, -50)
+            self.assertLess(len(history), 1000000)
+
+    def test_quio_beta_schedule(self):
+        Q = {(i,): -1.0 for i in range(10)}
+        bound_list = {i: (-2, 2) for i in range(10)}
+
+        r = oj.SASampler().sample_quio(Q, bound_list=bound_list, num_reads=2,
+                                       beta_schedule=[0.5, (2.0, 3), (10.0, 20)],
+                                       log_history=True, seed=self.seed)
+        for energy, history in zip(r.record.energy, r.info["log"]["temperature_history"]):
+            self.assertAlmostEqual(energy, -20)
+            np.testing.assert_allclose(history, [2.0] + [0.5]*3 + [0.1]*20)
+
+        for schedule in ["POWER_LAW", "EXPONENTIAL_PLATEAU"]:
+            r = oj.SASampler().sample_quio(Q, bound_list=bound_list, num_reads=2,
+                                           temperature_schedule=schedule, seed=self.seed)
+            self.assertEqual(len(r.record.sample), 2)
+
+    def test_quio_graph_coloring(self):
+        Q = {(0, 0): 2.0, (1, 1): 3.0, (2, 2): 1.0, (0, 1): -6.0, (0, 2): 2.0}
+        bound_list = {0: (-1, 2), 1: (-2, 1), 2: (0, 3)}
+
+        for x in self.upd:
+            r1 = oj.SASampler().sample_quio(Q, bound_list=bound_list, num_reads=10,
+                                            updater=x, num_threads=1,
+                                            graph_coloring=True, seed=self.seed)
+            r2 = oj.SASampler().sample_quio(Q, bound_list=bound_list, num_reads=10,
+                                            updater=x, num_threads=4,
+                                            graph_coloring=True, seed=self.seed)
+            self.assertAlmostEqual(r1.first.energy, -2)
+            np.testing.assert_array_equal(r1.record.sample, r2.record.sample)
+
+    def test_quio_fast_acceptance(self):
+        Q = {(0, 0): 2.0, (1, 1): 3.0, (2, 2): 1.0, (0, 1): -6.0, (0, 2): 2.0}
+        bound_list = {0: (-1, 2), 1: (-2, 1), 2: (0, 3)}
+
+        for x in self.upd:
+            r = oj.SASampler().sample_quio(Q, bound_list=bound_list, num_reads=30,
+                                           updater=x, fast_acceptance=True,
+                                           seed=self.seed)
+            self.assertAlmostEqual(r.first.energy, -2)
+            self.assertEqual(r.first.sample, {0: -1, 1: -1, 2: 1})
+            self.assertTrue(r.info["schedule"]["fast_acceptance"])
+
     def test_quio_integer_corner_case_1(self):
         Q = {}
         bound_list = {}
@@ -144,6 +144,12 @@ class TestSamplers(unittest.TestCase):
         self.assertEqual(len(res.states), 100)
         self.assertTrue(all(isinstance(energy, (int, float)) for energy in res.energies))
 
+        #antiferromagnetic one-dimensional Ising model with wolff
+        sampler = oj.SASampler()
+        res = sampler.sample_ising(self.afih, self.afiJ, updater='wolff', seed=1, num_reads=100)
+        self.assertEqual(len(res.states), 100)
+        self.assertTrue(all(isinstance(energy, (int, float)) for energy in res.energies))
+
     def test_sa_sparse(self):
         #sampler = oj.SASampler()
         #self.samplers(sampler)
@@ -176,6 +182,45 @@ class TestSamplers(unittest.TestCase):
         self.assertEqual(len(res.states), 100)
         self.assertTrue(all(isinstance(energy, (int, float)) for energy in res.energies))
 
+    def test_sa_graph_coloring(self):
+        #antiferromagnetic one-dimensional Ising model, whose spins of each color are flipped by num_threads threads
+        sampler = oj.SASampler()
+        res_list = [sampler.sample_ising(self.afih, self.afiJ, sparse=True, seed=1, num_reads=2,
+                                         graph_coloring=True, num_threads=num_threads)
+                    for num_threads in [1, 4]]
+        self.assertTrue(np.array_equal(res_list[0].record.sample, res_list[1].record.sample))
+        self.assertTrue(np.allclose(res_list[0].energies, res_list[1].energies))
+
+    def test_sa_dense_precision(self):
+        #antiferromagnetic one-dimensional Ising model with compact dense storage
+        sampler = oj.SASampler()
+        for dense_precision in ["float32", "bfloat16"]:
+            res = sampler.sample_ising(self.afih, self.afiJ, sparse=False, seed=1, num_reads=10,
+                                       dense_precision=dense_precision)
+            self.assertEqual(len(res.states), 10)
+            sample = res.first.sample
+            energy = sum(h * sample[i] for i, h in self.afih.items())
+            energy += sum(J * sample[i] * sample[j] for (i, j), J in self.afiJ.items())
+            self.assertAlmostEqual(res.first.energy, energy, places=4)
+
+        # the energies follow the double-precision couplings, which bfloat16 rounds
+        rng = np.random.default_rng(0)
+        N = 30
+        h = {i: rng.normal() for i in range(N)}
+        J = {(i, j): rng.normal() for i in range(N) for j in range(i + 1, N)}
+        for dense_precision in ["float32", "bfloat16"]:
+            res = sampler.sample_ising(h, J, sparse=False, seed=2, num_reads=5, num_sweeps=300,
+                                       dense_precision=dense_precision)
+            for sample, energy in zip(res.samples(), res.energies):
+                exact = sum(v * sample[i] for i, v in h.items())
+                exact += sum(v * sample[i] * sample[j] for (i, j), v in J.items())
+                self.assertAlmostEqual(energy, exact, places=8)
+
+        with self.assertRaises(ValueError):
+            sampler.sample_ising(self.afih, self.afiJ, sparse=True, dense_precision="float32")
+        with self.assertRaises(ValueError):
+            sampler.sample_ising(self.afih, self.afiJ, sparse=False, dense_precision="float16")
+
     def test_sa_with_negative_interactions(self):
         # sa with negative interactions
         sampler = oj.SASampler()